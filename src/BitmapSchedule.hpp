@@ -0,0 +1,121 @@
+#ifndef BITMAPSCHEDULE_HPP
+#define BITMAPSCHEDULE_HPP
+
+#include <stdint.h>
+#include <string.h>
+#include "LampSchedule.hpp"
+#include "PersistentConfiguration.hpp"
+#include "CivilTime.hpp"
+#include "constants.h"
+
+#define MINUTES_PER_DAY 1440
+#define BITMAP_WORDS (MINUTES_PER_DAY / 32)
+
+/**
+ * Alternative to LampSchedule with the same interface: intervals are rasterized into
+ * a 1440-bit minute-of-day bitmap per channel (180 bytes each whatever NUM_INTERVALS is),
+ * so the state of a channel is a single bit test. A minute is on if any second of it is
+ * within an interval, so transitions are rounded to the minute.
+ */
+class BitmapSchedule
+{
+public:
+    BitmapSchedule();
+
+    /**
+     * Rasterizes the intervals into the bitmap
+     */
+    void Compile(PersistentConfiguration *persistentConfiguration, const SunTimes &sunTimes);
+
+    /**
+     * @param secondOfDay seconds since midnight
+     * @return state of all channels at the given time, bit set if the lamp is on
+     */
+    ChannelMask GetState(long secondOfDay);
+
+    /**
+     * @param secondOfDay seconds since midnight
+     * @return second of day of the first transition after the given time,
+     * SECONDS_PER_DAY if there is none until midnight
+     */
+    long NextTransition(long secondOfDay);
+
+private:
+    uint32_t _bitmap[NUM_CHANNELS][BITMAP_WORDS];
+
+    void SetRange(uint32_t *bitmap, int first, int last);
+};
+
+BitmapSchedule::BitmapSchedule()
+{
+    memset(_bitmap, 0, sizeof(_bitmap));
+}
+
+void BitmapSchedule::SetRange(uint32_t *bitmap, int first, int last)
+{
+    for (int word = first / 32; word <= last / 32; word++)
+    {
+        uint32_t mask = 0xFFFFFFFF;
+        if (word == first / 32)
+            mask &= 0xFFFFFFFF << (first % 32);
+        if (word == last / 32)
+            mask &= 0xFFFFFFFF >> (31 - last % 32);
+        bitmap[word] |= mask;
+    }
+}
+
+void BitmapSchedule::Compile(PersistentConfiguration *persistentConfiguration, const SunTimes &sunTimes)
+{
+    memset(_bitmap, 0, sizeof(_bitmap));
+
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        TimerInterval ti = persistentConfiguration->GetTimerInterval(i);
+        long on, off;
+        if (!LampSchedule::ResolveInterval(ti, sunTimes, on, off))
+            continue;
+
+        ChannelMask channels = LampSchedule::IntervalChannels(ti);
+        for (int channel = 0; channel < NUM_CHANNELS; channel++)
+        {
+            if (channels >> channel & 1)
+                SetRange(_bitmap[channel], on / 60, off / 60);
+        }
+    }
+}
+
+ChannelMask BitmapSchedule::GetState(long secondOfDay)
+{
+    int minute = secondOfDay / 60;
+    ChannelMask state = 0;
+    for (int channel = 0; channel < NUM_CHANNELS; channel++)
+        state |= ((_bitmap[channel][minute / 32] >> (minute % 32)) & 1) << channel;
+    return state;
+}
+
+long BitmapSchedule::NextTransition(long secondOfDay)
+{
+    int minute = secondOfDay / 60;
+    int first = minute / 32;
+    uint32_t after = minute % 32 == 31 ? 0 : 0xFFFFFFFF << (minute % 32 + 1);
+    long next = SECONDS_PER_DAY;
+
+    for (int channel = 0; channel < NUM_CHANNELS; channel++)
+    {
+        uint32_t *bitmap = _bitmap[channel];
+
+        // Bits differing from the current state, after the current minute
+        uint32_t current = (bitmap[first] >> (minute % 32)) & 1 ? 0xFFFFFFFF : 0;
+        int word = first;
+        uint32_t changes = (bitmap[word] ^ current) & after;
+        while (!changes && ++word < BITMAP_WORDS && word * 32L * 60 < next)
+            changes = bitmap[word] ^ current;
+
+        if (changes && (word * 32L + __builtin_ctz(changes)) * 60 < next)
+            next = (word * 32L + __builtin_ctz(changes)) * 60;
+    }
+
+    return next;
+}
+
+#endif
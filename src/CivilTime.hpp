@@ -0,0 +1,129 @@
+#ifndef CIVILTIME_HPP
+#define CIVILTIME_HPP
+
+#include <ctime>
+
+/**
+ * Integer civil calendar arithmetic (proleptic Gregorian, UTC), replacing
+ * gmtime/localtime/mktime: no static buffers, no TZ lookup, constexpr-capable.
+ * Algorithms from H. Hinnant, "chrono-Compatible Low-Level Date Algorithms".
+ */
+
+#define SECONDS_PER_DAY 86400L
+
+struct CivilDate
+{
+    int year;
+    unsigned month; // 1-12
+    unsigned day;   // 1-31
+};
+
+/// Helpers, written as single expressions to stay C++11 constexpr
+
+constexpr long civil_era(long y) { return (y >= 0 ? y : y - 399) / 400; }
+
+constexpr unsigned civil_doy_from_march(unsigned m, unsigned d) { return (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1; }
+
+constexpr long civil_days(long era, unsigned yoe, unsigned doy)
+{
+    return era * 146097 + (long)(yoe * 365 + yoe / 4 - yoe / 100 + doy) - 719468;
+}
+
+constexpr unsigned civil_yoe(unsigned doe) { return (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; }
+
+constexpr unsigned civil_mp(unsigned doy) { return (5 * doy + 2) / 153; }
+
+constexpr CivilDate civil_date(long y, unsigned mp, unsigned doy)
+{
+    return CivilDate{(int)(y + (mp >= 10)), mp < 10 ? mp + 3 : mp - 9, doy - (153 * mp + 2) / 5 + 1};
+}
+
+constexpr CivilDate civil_from_yoe(long era, unsigned doe, unsigned yoe)
+{
+    return civil_date(yoe + era * 400, civil_mp(doe - (365 * yoe + yoe / 4 - yoe / 100)),
+                      doe - (365 * yoe + yoe / 4 - yoe / 100));
+}
+
+constexpr CivilDate civil_from_era(long era, long z)
+{
+    return civil_from_yoe(era, (unsigned)(z - era * 146097), civil_yoe((unsigned)(z - era * 146097)));
+}
+
+/// Public API
+
+/**
+ * @return days since 1970-01-01 of the given date
+ */
+constexpr long days_from_civil(int year, unsigned month, unsigned day)
+{
+    return civil_days(civil_era(year - (month <= 2)),
+                      (unsigned)(year - (month <= 2) - civil_era(year - (month <= 2)) * 400),
+                      civil_doy_from_march(month, day));
+}
+
+/**
+ * @param days since 1970-01-01
+ * @return the corresponding date
+ */
+constexpr CivilDate civil_from_days(long days)
+{
+    return civil_from_era((days + 719468 >= 0 ? days + 719468 : days + 719468 - 146096) / 146097, days + 719468);
+}
+
+constexpr bool is_leap_year(int year) { return year % 4 == 0 && (year % 100 != 0 || year % 400 == 0); }
+
+/**
+ * @return days since January 1st, in the range 0-365 like tm_yday
+ */
+constexpr unsigned day_of_year(int year, unsigned month, unsigned day)
+{
+    return (unsigned)(days_from_civil(year, month, day) - days_from_civil(year, 1, 1));
+}
+
+/**
+ * @param days since 1970-01-01
+ * @return day of the week, 0 is Sunday like tm_wday
+ */
+constexpr unsigned weekday(long days) { return (unsigned)(days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6); }
+
+/**
+ * @return days since 1970-01-01 of the given time, rounding towards the past
+ */
+constexpr long days_from_time(time_t t)
+{
+    return (long)(t >= 0 ? t / SECONDS_PER_DAY : (t - (SECONDS_PER_DAY - 1)) / SECONDS_PER_DAY);
+}
+
+/**
+ * @return seconds since midnight of the given time
+ */
+constexpr long seconds_of_day(time_t t) { return (long)(t - (time_t)days_from_time(t) * SECONDS_PER_DAY); }
+
+/**
+ * @return the time_t of the given UTC date and time, like timegm
+ */
+constexpr time_t time_from_civil(int year, unsigned month, unsigned day, int hour = 0, int min = 0, int sec = 0)
+{
+    return (time_t)days_from_civil(year, month, day) * SECONDS_PER_DAY + hour * 3600L + min * 60L + sec;
+}
+
+/**
+ * Reentrant replacement of gmtime, tm_isdst is always 0.
+ */
+inline void civil_time(time_t t, std::tm &tm)
+{
+    long days = days_from_time(t);
+    long seconds = seconds_of_day(t);
+    CivilDate date = civil_from_days(days);
+    tm.tm_year = date.year - 1900;
+    tm.tm_mon = date.month - 1;
+    tm.tm_mday = date.day;
+    tm.tm_hour = seconds / 3600;
+    tm.tm_min = seconds / 60 % 60;
+    tm.tm_sec = seconds % 60;
+    tm.tm_wday = weekday(days);
+    tm.tm_yday = day_of_year(date.year, date.month, date.day);
+    tm.tm_isdst = 0;
+}
+
+#endif
@@ -0,0 +1,408 @@
+#ifndef EVENTJOURNAL_HPP
+#define EVENTJOURNAL_HPP
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "Crc.hpp"
+#include "FlashStorage.hpp"
+#include "Scheduler.hpp"
+#include "constants.h"
+#include "debug.h"
+
+enum EventCode : uint8_t
+{
+    EVENT_LAMP_ON,
+    EVENT_LAMP_OFF,
+    EVENT_CHANNEL_ON,  // Argument: channel, from 1
+    EVENT_CHANNEL_OFF, // Argument: channel, from 1
+    EVENT_RTC_SYNCED,
+    EVENT_WIFI_REQUESTED,
+    EVENT_CONFIGURATION_CHANGED,
+    EVENT_WIFI_ACTIVE,
+    EVENT_WIFI_INACTIVE,
+    EVENT_WIFI_FAILED, // Argument: seconds before retrying
+    NUM_EVENT_CODES
+};
+
+/**
+ * Event as stored in the log, formatted to text only when printed
+ */
+struct EventRecord
+{
+    uint32_t epoch; // Local time, seconds since 1970-01-01
+    EventCode code;
+    uint8_t reserved;
+    uint16_t argument;
+};
+
+/**
+ * Append-only event journal in flash, so the log survives restarts and power cuts.
+ * The storage is JOURNAL_SECTORS sectors of the filesystem partition.
+ *
+ * Sectors are used round robin, which levels the wear: each starts with a header
+ * holding a sequence number, the number of its first record and a base epoch, followed by records of
+ * [length][varint epoch delta, code, varint argument][crc32 low byte]. A record never
+ * crosses a flash page, the rest of the page is padded with 0x00, and 0xFF marks the
+ * erased space after the last record. Records are collected in a page buffer and written
+ * when the page is full or JOURNAL_FLUSH_DELAY after the first unwritten record.
+ */
+class EventJournal : public Task
+{
+public:
+    static const uint32_t FLASH_PAGE_SIZE = 256;
+
+    EventJournal(FlashStorage *const storage);
+
+    /**
+     * Recovers the journal, reading only the sector headers and the records.
+     *
+     * @param replay called with every record, oldest first
+     */
+    void Begin(void (*replay)(const EventRecord &record, void *context), void *context);
+
+    void Append(const EventRecord &record);
+
+    /**
+     * @return the number the next record will get. Records are numbered from the first
+     * one of the journal, so numbers carry on across restarts.
+     */
+    uint32_t Records();
+
+    /**
+     * Writes the unwritten records, e.g. before a restart.
+     */
+    void Flush();
+
+    /**
+     * Writes the unwritten records once they are JOURNAL_FLUSH_DELAY old.
+     */
+    unsigned long Run() override;
+
+private:
+    struct SectorHeader
+    {
+        uint32_t magic;
+        uint32_t sequence;
+        uint32_t first; // Number of the first record
+        uint32_t epoch; // Base of the epoch delta of the first record
+        uint32_t crc;
+    };
+
+    static const uint32_t MAGIC = 0x324C5645; // "EVL2"
+    static const uint8_t MAX_PAYLOAD = 9;      // 5 bytes delta, code, 3 bytes argument
+    static const uint8_t PADDING = 0x00;
+    static const uint8_t ERASED = 0xFF;
+
+    FlashStorage *const _storage;
+    uint32_t _sectors = 0;
+    uint32_t _sequence = UINT32_MAX; // Sequence of the current sector, the next is 0 on a new journal
+    uint32_t _sector = 0;
+    uint32_t _pageAddress;           // Offset in the sector of the buffered page
+    uint32_t _offset;                // Offset in the sector of the next record
+    uint32_t _written;               // Offset in the sector up to which the records are in flash
+    uint32_t _lastEpoch = 0;
+    uint32_t _records = 0;           // Number of the next record
+    uint32_t _page[FLASH_PAGE_SIZE / 4];
+    bool _pending = false;
+    unsigned long _pendingSince = 0;
+
+    uint8_t *PageBytes() { return (uint8_t *)_page; }
+    bool ReadHeader(uint32_t sector, SectorHeader &header);
+    uint32_t ScanSector(uint32_t sector, void (*replay)(const EventRecord &record, void *context), void *context);
+    bool IsErased(uint32_t sector, uint32_t from);
+    void StartSector(uint32_t epoch);
+    void WritePage();
+    void NextPage();
+    static uint8_t Encode(const EventRecord &record, uint32_t lastEpoch, uint8_t *buffer);
+    static bool Decode(const uint8_t *buffer, uint8_t length, uint32_t lastEpoch, EventRecord &record);
+};
+
+EventJournal::EventJournal(FlashStorage *const storage)
+    : _storage(storage)
+{
+    // Full, so that the first record starts a sector
+    _pageAddress = _offset = _written = FlashStorage::FLASH_SECTOR_SIZE;
+}
+
+void EventJournal::Begin(void (*replay)(const EventRecord &record, void *context), void *context)
+{
+    _sectors = _storage->Sectors();
+
+    // The current sector has the highest sequence
+    bool found = false;
+    SectorHeader header;
+    for (uint32_t sector = 0; sector < _sectors; sector++)
+    {
+        if (ReadHeader(sector, header) && (!found || (int32_t)(header.sequence - _sequence) > 0))
+        {
+            _sequence = header.sequence;
+            found = true;
+        }
+    }
+
+    if (!found)
+        return;
+
+    // Replay the sectors oldest first
+    uint32_t first = _sequence >= _sectors ? _sequence - _sectors + 1 : 0;
+    for (uint32_t sequence = first; sequence != _sequence + 1; sequence++)
+    {
+        uint32_t sector = sequence % _sectors;
+        if (!ReadHeader(sector, header) || header.sequence != sequence)
+            continue;
+
+        _lastEpoch = header.epoch;
+        _records = header.first;
+        _offset = ScanSector(sector, replay, context);
+    }
+
+    // Append after the last record, or start a new sector if the current one is full or damaged
+    _sector = _sequence % _sectors;
+    _written = _offset;
+    _pageAddress = _offset & ~(FLASH_PAGE_SIZE - 1);
+    if (_pageAddress < FlashStorage::FLASH_SECTOR_SIZE)
+        _storage->Read(_sector * FlashStorage::FLASH_SECTOR_SIZE + _pageAddress, _page, FLASH_PAGE_SIZE);
+
+    LOGDEBUG(F("Event journal at sequence "));
+    LOGDEBUG(_sequence);
+    LOGDEBUG(F(", offset "));
+    LOGDEBUGLN(_offset);
+}
+
+void EventJournal::Append(const EventRecord &record)
+{
+    if (_sectors == 0)
+        return;
+
+    if (_pageAddress >= FlashStorage::FLASH_SECTOR_SIZE)
+        StartSector(record.epoch);
+
+    uint8_t buffer[MAX_PAYLOAD + 2];
+    uint8_t length = Encode(record, _lastEpoch, buffer);
+    if (_offset - _pageAddress + length > FLASH_PAGE_SIZE)
+    {
+        memset(PageBytes() + _offset - _pageAddress, PADDING, _pageAddress + FLASH_PAGE_SIZE - _offset);
+        _offset = _pageAddress + FLASH_PAGE_SIZE;
+        WritePage();
+        NextPage();
+        if (_pageAddress >= FlashStorage::FLASH_SECTOR_SIZE)
+            StartSector(record.epoch);
+        length = Encode(record, _lastEpoch, buffer);
+    }
+
+    memcpy(PageBytes() + _offset - _pageAddress, buffer, length);
+    _offset += length;
+    _lastEpoch = record.epoch;
+    _records++;
+
+    if (_offset - _pageAddress == FLASH_PAGE_SIZE)
+    {
+        WritePage();
+        NextPage();
+    }
+    else if (!_pending)
+    {
+        _pending = true;
+        _pendingSince = millis();
+        Wake();
+    }
+}
+
+uint32_t EventJournal::Records()
+{
+    return _records;
+}
+
+void EventJournal::Flush()
+{
+    if (_pending)
+        WritePage();
+}
+
+unsigned long EventJournal::Run()
+{
+    if (!_pending)
+        return IDLE;
+
+    unsigned long elapsed = millis() - _pendingSince;
+    if (elapsed < JOURNAL_FLUSH_DELAY)
+        return JOURNAL_FLUSH_DELAY - elapsed;
+
+    WritePage();
+    return IDLE;
+}
+
+bool EventJournal::ReadHeader(uint32_t sector, SectorHeader &header)
+{
+    return _storage->Read(sector * FlashStorage::FLASH_SECTOR_SIZE, (uint32_t *)&header, sizeof(header)) &&
+           header.magic == MAGIC &&
+           header.crc == crc32(&header, offsetof(SectorHeader, crc));
+}
+
+/**
+ * @return the offset of the erased space after the last record, FLASH_SECTOR_SIZE
+ * if the sector is full or damaged
+ */
+uint32_t EventJournal::ScanSector(uint32_t sector, void (*replay)(const EventRecord &record, void *context), void *context)
+{
+    const uint8_t *bytes = PageBytes();
+    for (uint32_t page = 0; page < FlashStorage::FLASH_SECTOR_SIZE; page += FLASH_PAGE_SIZE)
+    {
+        if (!_storage->Read(sector * FlashStorage::FLASH_SECTOR_SIZE + page, _page, FLASH_PAGE_SIZE))
+            return FlashStorage::FLASH_SECTOR_SIZE;
+
+        uint32_t position = page == 0 ? sizeof(SectorHeader) : 0;
+        while (position < FLASH_PAGE_SIZE)
+        {
+            uint8_t length = bytes[position];
+            if (length == PADDING)
+            {
+                position++;
+                continue;
+            }
+
+            // A torn write leaves programmed bytes after the end
+            if (length == ERASED)
+                return IsErased(sector, page + position) ? page + position : FlashStorage::FLASH_SECTOR_SIZE;
+
+            EventRecord record;
+            if (length > MAX_PAYLOAD || position + length + 2 > FLASH_PAGE_SIZE ||
+                bytes[position + length + 1] != (uint8_t)crc32(bytes + position, length + 1) ||
+                !Decode(bytes + position + 1, length, _lastEpoch, record))
+                return FlashStorage::FLASH_SECTOR_SIZE;
+
+            replay(record, context);
+            _lastEpoch = record.epoch;
+            _records++;
+            position += length + 2;
+        }
+    }
+
+    return FlashStorage::FLASH_SECTOR_SIZE;
+}
+
+bool EventJournal::IsErased(uint32_t sector, uint32_t from)
+{
+    const uint8_t *bytes = PageBytes();
+    for (uint32_t page = from & ~(FLASH_PAGE_SIZE - 1); page < FlashStorage::FLASH_SECTOR_SIZE; page += FLASH_PAGE_SIZE)
+    {
+        if (!_storage->Read(sector * FlashStorage::FLASH_SECTOR_SIZE + page, _page, FLASH_PAGE_SIZE))
+            return false;
+
+        for (uint32_t i = from > page ? from - page : 0; i < FLASH_PAGE_SIZE; i++)
+        {
+            if (bytes[i] != ERASED)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+void EventJournal::StartSector(uint32_t epoch)
+{
+    _sequence++;
+    _sector = _sequence % _sectors;
+    _storage->EraseSector(_sector);
+
+    SectorHeader header;
+    header.magic = MAGIC;
+    header.sequence = _sequence;
+    header.first = _records;
+    header.epoch = epoch;
+    header.crc = crc32(&header, offsetof(SectorHeader, crc));
+
+    memset(_page, ERASED, FLASH_PAGE_SIZE);
+    memcpy(_page, &header, sizeof(header));
+    _pageAddress = 0;
+    _written = 0;
+    _offset = sizeof(header);
+    _lastEpoch = epoch;
+}
+
+/**
+ * Writes the buffered page from the last written word. Bytes written again keep their value.
+ */
+void EventJournal::WritePage()
+{
+    uint32_t from = _written & ~3;
+    uint32_t to = (_offset + 3) & ~3;
+    if (to > from)
+        _storage->Write(_sector * FlashStorage::FLASH_SECTOR_SIZE + from, _page + (from - _pageAddress) / 4, to - from);
+
+    _written = _offset;
+    _pending = false;
+}
+
+void EventJournal::NextPage()
+{
+    _pageAddress += FLASH_PAGE_SIZE;
+    memset(_page, ERASED, FLASH_PAGE_SIZE);
+}
+
+/**
+ * @return the size of the encoded record
+ */
+uint8_t EventJournal::Encode(const EventRecord &record, uint32_t lastEpoch, uint8_t *buffer)
+{
+    // Zigzag, as NTP may move the time back
+    int32_t delta = (int32_t)(record.epoch - lastEpoch);
+    uint32_t value = ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+
+    uint8_t length = 1;
+    do
+    {
+        buffer[length++] = (value & 0x7F) | (value > 0x7F ? 0x80 : 0);
+        value >>= 7;
+    } while (value);
+
+    buffer[length++] = record.code;
+
+    value = record.argument;
+    do
+    {
+        buffer[length++] = (value & 0x7F) | (value > 0x7F ? 0x80 : 0);
+        value >>= 7;
+    } while (value);
+
+    buffer[0] = length - 1;
+    buffer[length] = (uint8_t)crc32(buffer, length);
+    return length + 1;
+}
+
+bool EventJournal::Decode(const uint8_t *buffer, uint8_t length, uint32_t lastEpoch, EventRecord &record)
+{
+    uint8_t position = 0;
+    uint32_t values[2];
+    for (int i = 0; i < 2; i++)
+    {
+        values[i] = 0;
+        for (int shift = 0;; shift += 7)
+        {
+            if (position >= length || shift > 28)
+                return false;
+
+            uint8_t byte = buffer[position++];
+            values[i] |= (uint32_t)(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                break;
+        }
+
+        // The code sits between the delta and the argument
+        if (i == 0)
+        {
+            if (position >= length)
+                return false;
+            record.code = (EventCode)buffer[position++];
+        }
+    }
+
+    int32_t delta = (int32_t)(values[0] >> 1) ^ -(int32_t)(values[0] & 1);
+    record.epoch = lastEpoch + delta;
+    record.reserved = 0;
+    record.argument = values[1];
+    return position == length && values[1] <= UINT16_MAX;
+}
+
+#endif
@@ -1,52 +1,179 @@
 #ifndef EVENTLOGGER_HPP
 #define EVENTLOGGER_HPP
 
-#include <deque>
 #include <Arduino.h>
-#include <ctime>
+#include <stdint.h>
+#include "EventJournal.hpp"
 #include "NTPClient.hpp"
+#include "CivilTime.hpp"
 #include "constants.h"
 #include "debug.h"
 
+/**
+ * Log of the last NUM_EVENTS events in a statically allocated ring of 8-byte records,
+ * also appended to the flash journal. Logging never allocates.
+ */
 class EventLogger
 {
 private:
     NTPClient *const _ntpClient;
-    std::deque<String> _events;
+    EventJournal *const _journal;
+    EventRecord _events[NUM_EVENTS];
+    unsigned int _next = 0;  // Ring index of the next record
+    unsigned int _count = 0; // Records in the ring
+    unsigned long _total = 0; // Sequence number of the next event, carried on from the journal
+
+    void Push(const EventRecord &event);
+    static void Replay(const EventRecord &event, void *context);
+    static size_t FormatEvent(const EventRecord &event, char *buffer, size_t size);
 
 public:
-    EventLogger(NTPClient *const ntpClient);
-    void LogEvent(const String &event);
-    String PrintEvents();
+    EventLogger(NTPClient *const ntpClient, EventJournal *const journal);
+
+    /**
+     * Loads the events of the journal.
+     */
+    void Begin();
+    void LogEvent(EventCode code, uint16_t argument = 0);
+
+    /**
+     * Writes the events still in RAM to the journal, e.g. before a restart.
+     */
+    void Flush();
+
+    /**
+     * @return the sequence number of the oldest event in the log. Numbers are those of the
+     * journal, so they carry on across restarts; without flash they restart at every boot.
+     */
+    unsigned long FirstSequence();
+
+    /**
+     * @return the sequence number the next event will get
+     */
+    unsigned long NextSequence();
+
+    /**
+     * Formats events oldest first, one per line, as many whole lines as fit in the buffer.
+     *
+     * @param sequence first event to format, advanced past the formatted ones
+     * @param end sequence number after the last event to format
+     * @return the length of the text, 0 when there is nothing left to format
+     */
+    size_t PrintEvents(unsigned long &sequence, unsigned long end, char *buffer, size_t size);
 };
 
-EventLogger::EventLogger(NTPClient *const ntpClient)
-    : _ntpClient(ntpClient)
+EventLogger::EventLogger(NTPClient *const ntpClient, EventJournal *const journal)
+    : _ntpClient(ntpClient),
+      _journal(journal)
+{
+}
+
+void EventLogger::Begin()
 {
+    _journal->Begin(Replay, this);
+    _total = _journal->Records();
 }
 
-void EventLogger::LogEvent(const String &event)
+void EventLogger::LogEvent(EventCode code, uint16_t argument)
 {
-    long now = (long) _ntpClient->getEpochTime();
-    std::tm dayNow = *std::localtime(&now);
-    String log = String(dayNow.tm_mday) + "/" + String(dayNow.tm_mon + 1) + "/" + String(dayNow.tm_year + 1900) + " " +
-                 _ntpClient->getFormattedTime() + " " + event;
-    _events.push_back(log);
-    LOGDEBUGLN(log);
+    EventRecord event;
+    event.epoch = _ntpClient->getSnapshot().epoch;
+    event.code = code;
+    event.reserved = 0;
+    event.argument = argument;
 
-    if (_events.size() > NUM_EVENTS)
-        _events.pop_front();
+    Push(event);
+    _journal->Append(event);
+
+#ifdef DEBUG
+    char buffer[64];
+    FormatEvent(event, buffer, sizeof(buffer));
+    LOGDEBUGLN(buffer);
+#endif
+}
+
+void EventLogger::Flush()
+{
+    _journal->Flush();
 }
 
-String EventLogger::PrintEvents()
+void EventLogger::Push(const EventRecord &event)
 {
-    String ret = "";
-    for (auto it = _events.rbegin(); it != _events.rend(); it++)
+    _events[_next] = event;
+    _next = (_next + 1) % NUM_EVENTS;
+    if (_count < NUM_EVENTS)
+        _count++;
+    _total++;
+}
+
+void EventLogger::Replay(const EventRecord &event, void *context)
+{
+    ((EventLogger *)context)->Push(event);
+}
+
+size_t EventLogger::FormatEvent(const EventRecord &event, char *buffer, size_t size)
+{
+    static const char *const messages[NUM_EVENT_CODES] = {
+        "Lamp ON.",
+        "Lamp OFF.",
+        "Lamp %u ON.",
+        "Lamp %u OFF.",
+        "RTC synced.",
+        "Requested WiFi ON.",
+        "Configuration changed.",
+        "WiFi active.",
+        "WiFi inactive.",
+        "WiFi connection failed, retrying in %u s."};
+
+    long days = days_from_time(event.epoch);
+    long seconds = seconds_of_day(event.epoch);
+    CivilDate date = civil_from_days(days);
+    int length = snprintf(buffer, size, "%u/%u/%d %02ld:%02ld:%02ld ",
+                          date.day, date.month, date.year, seconds / 3600, seconds / 60 % 60, seconds % 60);
+    if (length < 0 || (size_t)length >= size)
+        return size - 1;
+
+    const char *message = event.code < NUM_EVENT_CODES ? messages[event.code] : "Unknown event %u.";
+    int messageLength = snprintf(buffer + length, size - length, message,
+                                 event.code < NUM_EVENT_CODES ? event.argument : event.code);
+    if (messageLength < 0 || (size_t)(length + messageLength) >= size)
+        return size - 1;
+
+    return length + messageLength;
+}
+
+unsigned long EventLogger::FirstSequence()
+{
+    return _total - _count;
+}
+
+unsigned long EventLogger::NextSequence()
+{
+    return _total;
+}
+
+size_t EventLogger::PrintEvents(unsigned long &sequence, unsigned long end, char *buffer, size_t size)
+{
+    if (sequence < FirstSequence())
+        sequence = FirstSequence();
+    if (end > _total)
+        end = _total;
+
+    // Sequence numbers map to the ring without searching
+    size_t length = 0;
+    char line[64];
+    for (; sequence < end; sequence++)
     {
-        ret += *it + "\n";
+        size_t lineLength = FormatEvent(_events[(_next + NUM_EVENTS - (_total - sequence)) % NUM_EVENTS], line, sizeof(line) - 1);
+        line[lineLength++] = '\n';
+        if (length + lineLength > size)
+            break;
+
+        memcpy(buffer + length, line, lineLength);
+        length += lineLength;
     }
 
-    return ret;
+    return length;
 }
 
-#endif
\ No newline at end of file
+#endif
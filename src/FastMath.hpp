@@ -0,0 +1,131 @@
+#ifndef FASTMATH_HPP
+#define FASTMATH_HPP
+
+#include <cmath>
+
+/**
+ * Trigonometric backend forwarding to the standard library.
+ */
+template <typename Real>
+struct StdMath
+{
+    static Real sin(Real x) { return std::sin(x); }
+    static Real cos(Real x) { return std::cos(x); }
+    static Real tan(Real x) { return std::tan(x); }
+    static Real asin(Real x) { return std::asin(x); }
+    static Real acos(Real x) { return std::acos(x); }
+};
+
+/**
+ * Trigonometric backend based on polynomial approximations.
+ *
+ * sin/cos/tan reduce the argument to [-pi/4, pi/4] and evaluate minimax
+ * polynomials, asin/acos use the Abramowitz & Stegun 4.4.45/4.4.46 forms.
+ * Worst-case error in double against std, by Precision (absolute, relative
+ * for tan beyond ±1):
+ *   1: sin/cos 1.3e-5, tan 1.7e-5, asin/acos 6.8e-5
+ *   2: sin/cos 1.1e-7, tan 1.3e-7, asin/acos 2.2e-8
+ * sin and cos share the error: odd quadrants of sin evaluate the cos polynomial.
+ * With float the error is bounded by single precision at Precision 2.
+ *
+ * Effect on SunclockF sunrise/sunset against Sunclock, latitudes -60°..60°:
+ * Precision 1 up to 4 s, Precision 2 up to 1 s, like std. Closer to the polar
+ * circles float itself loses precision: at 61°..65° std and Precision 2 reach
+ * 14 s, Precision 1 120 s. Measured by test/test_fastmath.
+ */
+template <typename Real, int Precision = 2>
+struct FastMath
+{
+    static Real sin(Real x)
+    {
+        Real r;
+        switch (reduce(x, r) & 3)
+        {
+        case 0:
+            return sin_kernel(r);
+        case 1:
+            return cos_kernel(r);
+        case 2:
+            return -sin_kernel(r);
+        default:
+            return -cos_kernel(r);
+        }
+    }
+
+    static Real cos(Real x)
+    {
+        Real r;
+        switch (reduce(x, r) & 3)
+        {
+        case 0:
+            return cos_kernel(r);
+        case 1:
+            return -sin_kernel(r);
+        case 2:
+            return -cos_kernel(r);
+        default:
+            return sin_kernel(r);
+        }
+    }
+
+    static Real tan(Real x)
+    {
+        Real r;
+        int quadrant = reduce(x, r);
+        Real s = sin_kernel(r), c = cos_kernel(r);
+        return quadrant & 1 ? -c / s : s / c;
+    }
+
+    static Real asin(Real x)
+    {
+        return Real(1.5707963267948966) - acos(x);
+    }
+
+    static Real acos(Real x)
+    {
+        if (x < 0)
+            return Real(3.141592653589793) - acos_positive(-x);
+        return acos_positive(x);
+    }
+
+private:
+    /**
+     * Cody-Waite reduction: x = quadrant * pi/2 + r, with |r| <= pi/4.
+     * pi/2 is split in two parts to keep r accurate for large arguments.
+     */
+    static int reduce(Real x, Real &r)
+    {
+        int quadrant = (int)std::floor(x * Real(0.6366197723675814) + Real(0.5));
+        r = (x - quadrant * Real(1.5707963705062866)) - quadrant * Real(-4.371139000186241e-08);
+        return quadrant;
+    }
+
+    static Real sin_kernel(Real x)
+    {
+        Real z = x * x;
+        if (Precision < 2)
+            return x + x * z * (Real(-0.16662833806931793) + z * Real(0.008152992341814479));
+        return x + x * z * (Real(-0.1666666441334957) + z * (Real(0.008332647186971007) + z * Real(-0.00019566919991904132)));
+    }
+
+    static Real cos_kernel(Real x)
+    {
+        Real z = x * x;
+        if (Precision < 2)
+            return 1 + z * (Real(-0.49977630707616877) + z * Real(0.04048893584359353));
+        return 1 + z * (Real(-0.4999997976119165) + z * (Real(0.041660503436003894) + z * Real(-0.0013642348325434866)));
+    }
+
+    // Valid for 0 <= x <= 1, NaN above like std::acos
+    static Real acos_positive(Real x)
+    {
+        Real p;
+        if (Precision < 2)
+            p = Real(1.5707288) + x * (Real(-0.2121144) + x * (Real(0.0742610) + x * Real(-0.0187293)));
+        else
+            p = Real(1.5707963050) + x * (Real(-0.2145988016) + x * (Real(0.0889789874) + x * (Real(-0.0501743046) + x * (Real(0.0308918810) + x * (Real(-0.0170881256) + x * (Real(0.0066700901) + x * Real(-0.0012624911)))))));
+        return std::sqrt(1 - x) * p;
+    }
+};
+
+#endif
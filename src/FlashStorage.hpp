@@ -0,0 +1,73 @@
+#ifndef FLASHSTORAGE_HPP
+#define FLASHSTORAGE_HPP
+
+#include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Flash region made of erase blocks of FLASH_SECTOR_SIZE bytes. Addresses are relative
+ * to the region; reads and writes are word aligned, and a write can only clear bits
+ * of an erased sector.
+ */
+class FlashStorage
+{
+public:
+    static const uint32_t FLASH_SECTOR_SIZE = 4096;
+
+    virtual ~FlashStorage() {}
+
+    /**
+     * @return the number of sectors of the region
+     */
+    virtual uint32_t Sectors() = 0;
+    virtual bool Read(uint32_t address, uint32_t *data, size_t size) = 0;
+    virtual bool Write(uint32_t address, const uint32_t *data, size_t size) = 0;
+    virtual bool EraseSector(uint32_t sector) = 0;
+};
+
+#ifdef ARDUINO_ARCH_ESP8266
+#include <flash_hal.h>
+
+/**
+ * Sectors of the filesystem partition, which the sketch does not otherwise use.
+ * Regions that do not fit in the partition are empty.
+ */
+class EspFlashStorage : public FlashStorage
+{
+public:
+    EspFlashStorage(uint32_t firstSector, uint32_t sectors)
+        : _firstSector(firstSector),
+          _sectors(sectors)
+    {
+    }
+
+    uint32_t Sectors() override
+    {
+        return (_firstSector + _sectors) * FLASH_SECTOR_SIZE <= FS_PHYS_SIZE ? _sectors : 0;
+    }
+
+    bool Read(uint32_t address, uint32_t *data, size_t size) override
+    {
+        return ESP.flashRead(Base() + address, data, size);
+    }
+
+    bool Write(uint32_t address, const uint32_t *data, size_t size) override
+    {
+        return ESP.flashWrite(Base() + address, data, size);
+    }
+
+    bool EraseSector(uint32_t sector) override
+    {
+        return ESP.flashEraseSector(Base() / FLASH_SECTOR_SIZE + sector);
+    }
+
+private:
+    const uint32_t _firstSector;
+    const uint32_t _sectors;
+
+    uint32_t Base() { return FS_PHYS_ADDR + _firstSector * FLASH_SECTOR_SIZE; }
+};
+#endif
+
+#endif
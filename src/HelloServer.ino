@@ -3,158 +3,258 @@
 #include <WiFiUdp.h>
 #include "NTPClient.hpp"
 #include "EventLogger.hpp"
+#include "CivilTime.hpp"
+#include "LampSchedule.hpp"
+#include "BitmapSchedule.hpp"
+#include "PlanCache.hpp"
+#include "Scheduler.hpp"
+#include "SpscQueue.hpp"
+#include <coredecls.h>
 #include "debug.h"
 #include "constants.h"
 
-// PINS - D4: builtin led, D1: lamp relay, D3: WiFi on interrupt
+// PINS - D4: builtin led, LAMP_PINS: lamp relays (D1 by default), D3: WiFi on interrupt
+
+const uint8_t lampPins[NUM_CHANNELS] = LAMP_PINS;
+const char *const ntpServers[] = NTP_SERVERS;
 
 WiFiUDP ntpUDP;
 NTPClient timeClient(ntpUDP);
 ESP8266WebServer webServer(80);
-EventLogger eventLogger(&timeClient);
-PlatformManager platformManager(D4, D1, &eventLogger);
-PersistentConfiguration persistentConfiguration;
+EspFlashStorage journalStorage(0, JOURNAL_SECTORS);
+EspFlashStorage configurationStorage(JOURNAL_SECTORS, 2); // A/B slots
+EventJournal eventJournal(&journalStorage);
+EventLogger eventLogger(&timeClient, &eventJournal);
+PlatformManager platformManager(D4, lampPins, &eventLogger);
+PersistentConfiguration persistentConfiguration(&configurationStorage);
 WifiManager wifiManager(&webServer, &platformManager, &persistentConfiguration, &timeClient, &eventLogger);
+#ifdef BITMAP_SCHEDULE
+typedef BitmapSchedule DailySchedule;
+#else
+typedef LampSchedule DailySchedule;
+#endif
+PlanCache<DailySchedule> planCache;
+DailySchedule *lampSchedule = nullptr; // Plan of the current day
+volatile bool wakeRequested = false;
+
+// Inputs seen by the ISRs, handled by the loop
+enum InputType : uint8_t
+{
+  INPUT_WIFI_BUTTON
+};
+
+struct InputEvent
+{
+  InputType type;
+  unsigned long time; // millis()
+};
+
+SpscQueue<InputEvent> inputQueue;
+
+// Tasks of the cooperative runtime, none of them blocks the loop
+unsigned long runSchedule();
+unsigned long runTimeSync();
+unsigned long runWifi();
+unsigned long runInputs();
+FunctionTask inputTask(runInputs);
+FunctionTask scheduleTask(runSchedule);
+FunctionTask timeSyncTask(runTimeSync);
+FunctionTask wifiTask(runWifi);
+Scheduler scheduler;
+
+// Declared for builds other than the Arduino one, which generates them
+void sleepUntilNextTask();
+void manageLamp();
+void setSunTimes(SunTimes &sunTimes);
+void wifiOnISR();
+void printTime(time_t time);
 
 void setup()
 {
   Serial.begin(9600);
   pinMode(D4, OUTPUT);
-  pinMode(D1, OUTPUT);
+  for (int channel = 0; channel < NUM_CHANNELS; channel++)
+    pinMode(lampPins[channel], OUTPUT);
   pinMode(D3, INPUT_PULLUP);
+  eventLogger.Begin();
   wifiManager.Setup();
   webServer.begin();
+  timeClient.setPoolServerNames(ntpServers, sizeof(ntpServers) / sizeof(*ntpServers));
   timeClient.setUpdateInterval(NTP_UPDATE_INTERVAL);
   timeClient.setTimeOffset((int)persistentConfiguration.GetTimezoneOffset() * 60 * 60);
   timeClient.begin();
   attachInterrupt(digitalPinToInterrupt(D3), wifiOnISR, FALLING);
+  scheduler.Add(&inputTask);
+  scheduler.Add(&wifiTask);
+  scheduler.Add(&timeSyncTask);
+  scheduler.Add(&scheduleTask);
+  scheduler.Add(&platformManager);
+  scheduler.Add(&eventJournal);
 }
 
 void loop()
 {
-  houseKeeping();
+  timeClient.takeSnapshot();
+  scheduler.Run();
+  sleepUntilNextTask();
+}
 
+/**
+ * Keeps the lamps on schedule. Runs at the next lamp transition (or midnight, to compile
+ * the plan of the new day), and is polled while WiFi is on to catch configuration changes.
+ */
+unsigned long runSchedule()
+{
   if (wifiManager.IsSetupMode())
-  {
-    delay(500);
-    return;
-  }
+    return Task::IDLE;
 
-  // Normal operation
-  static int day = -1;
-  static time_t set, rise;
+  const TimeSnapshot &now = timeClient.getSnapshot();
+  long day = now.day;
+  unsigned int revision = persistentConfiguration.GetRevision();
 
-  // Recalculate rise and set times once a day
-  if (timeClient.getDay() != day)
+  // Compile the lamp schedule once a day and on configuration change
+  lampSchedule = planCache.Find(day, revision);
+  if (!lampSchedule)
   {
-    day = timeClient.getDay();
-    setRiseSetTimes(rise, set);
+    lampSchedule = planCache.Insert(day, revision);
+    SunTimes sunTimes;
+    setSunTimes(sunTimes);
+    lampSchedule->Compile(&persistentConfiguration, sunTimes);
   }
 
-  manageLamp(rise, set);
+  manageLamp();
+
+  unsigned long ms = (lampSchedule->NextTransition(now.secondOfDay) - now.secondOfDay - 1) * 1000UL +
+                     (1000 - now.millisecond);
 
-  delay(wifiManager.IsWifiOn() ? 500 : 10000);
+  if (wifiManager.IsWifiOn() && ms > WIFI_ON_LOOP_INTERVAL)
+    ms = WIFI_ON_LOOP_INTERVAL;
+
+  return ms;
 }
 
-std::tm getTime(const TimeType &type, const time_t &rise, const time_t &set, const std::tm &exactTime)
+/**
+ * Updates the time from NTP when due, polling the response without waiting for it.
+ * In setup mode, blinks the led instead.
+ */
+unsigned long runTimeSync()
 {
-  switch (type)
+  if (wifiManager.IsSetupMode())
+  {
+    platformManager.Blink(1, 500);
+    return 1500;
+  }
+
+  // Wait for the connection instead of letting the update time out
+  if (timeClient.getMillisToUpdate() == 0 && !wifiManager.IsConnected())
+  {
+    wifiManager.TurnWifiOn();
+    wifiTask.Wake();
+    return NTP_RETRY_INTERVAL;
+  }
+
+  switch (timeClient.update())
   {
-  case SUNRISE:
-    return *std::localtime(&rise);
-  case SUNSET:
-    return *std::localtime(&set);
+  case 0:
+    platformManager.Blink(3, 500);
+    wifiManager.TurnWifiOn();
+    wifiTask.Wake();
+    return NTP_RETRY_INTERVAL;
+  case 2:
+    eventLogger.LogEvent(EVENT_RTC_SYNCED);
+    scheduleTask.Wake(); // The day may have changed
+    break;
   default:
-    return exactTime;
+    if (!timeClient.isUpdating())
+      platformManager.Blink();
+    break;
   }
+
+  return timeClient.getMillisToUpdate();
 }
 
-int compareTimes(const std::tm &time1, const std::tm &time2)
+/**
+ * Serves the web server and manages the WiFi power state. Polled while WiFi is on,
+ * which also catches the WiFi timeout.
+ */
+unsigned long runWifi()
 {
-  int tm1 = time1.tm_hour * 60 * 60 + time1.tm_min * 60 + time1.tm_sec,
-      tm2 = time2.tm_hour * 60 * 60 + time2.tm_min * 60 + time2.tm_sec;
-
-  if (tm1 > tm2)
-    return 1;
-  else if (tm1 < tm2)
-    return -1;
-  else
-    return 0;
+  wifiManager.HandleClient();
+  webServer.handleClient();
+  wifiManager.WifiHousekeeping();
+
+  if (wifiManager.IsSetupMode() || wifiManager.IsWifiOn())
+    return WIFI_ON_LOOP_INTERVAL;
+  return Task::IDLE;
 }
 
-void manageLamp(time_t &rise, time_t &set)
+/**
+ * Handles the inputs queued by the ISRs, out of interrupt context.
+ */
+unsigned long runInputs()
 {
-  bool lampState = false;
-
-  for (int i = 0; i < NUM_INTERVALS; i++)
+  InputEvent input;
+  while (inputQueue.Pop(input))
   {
-    TimerInterval ti = persistentConfiguration.GetTimerInterval(i);
-    std::tm on = getTime(ti.onType, rise, set, ti.on);
-    std::tm off = getTime(ti.offType, rise, set, ti.off);
-    std::tm now;
-    now.tm_min = timeClient.getMinutes();
-    now.tm_hour = timeClient.getHours();
-    now.tm_sec = timeClient.getSeconds();
-
-    // Handle edge case of off time = midnight
-    if (!off.tm_hour && !off.tm_min && (on.tm_hour || on.tm_min))
+    switch (input.type)
     {
-      off.tm_hour = 23;
-      off.tm_min = 59;
-      off.tm_sec = 59;
+    case INPUT_WIFI_BUTTON:
+      if (!wifiManager.IsWifiOn())
+      {
+        wifiManager.TurnWifiOn();
+        platformManager.BlinkOn();
+        eventLogger.LogEvent(EVENT_WIFI_REQUESTED);
+      }
+      wifiTask.Wake();
+      scheduleTask.Wake();
+      break;
     }
-
-    // Set lamp state: ON state (true) is privileged and off time is intentionally inclusive
-    lampState = lampState || (compareTimes(now, on) >= 0 && compareTimes(now, off) <= 0);
   }
 
-  // Turn light on or off
-  if (lampState)
-    platformManager.LampOn();
-  else
-    platformManager.LampOff();
+  return Task::IDLE;
 }
 
-void setRiseSetTimes(time_t &rise, time_t &set)
+void sleepUntilNextTask()
 {
-  float lat, lng; // lat: 44.3316998, lng: 7.4774379
-  persistentConfiguration.GetCoordinates(lat, lng);
-  Sunclock sunclock(lat, lng, persistentConfiguration.GetTimezoneOffset());
-  set = sunclock.sunset(timeClient.getEpochTime());
-  rise = sunclock.sunrise(timeClient.getEpochTime());
-  LOGDEBUG(F("Current time (GMT): "));
-  LOGDEBUGLN(timeClient.getFormattedTime());
-  printTime(set);
-  printTime(rise);
+  // Since core 3.0 delay() is not cut short by esp_schedule(): esp_delay() checks
+  // the condition again each time wifiOnISR() resumes the loop
+  esp_delay(scheduler.MillisToNextTask(), []() { return !wakeRequested; });
+  wakeRequested = false;
 }
 
-void houseKeeping()
+void manageLamp()
 {
-  wifiManager.HandleClient();
-  webServer.handleClient();
+  // Turn lights on or off, all channels at once
+  platformManager.SetLampStates(lampSchedule->GetState(timeClient.getSnapshot().secondOfDay));
+}
 
-  if (wifiManager.IsSetupMode())
-  {
-    platformManager.Blink(1, 500);
-  }
-  else
-  {
-    switch (timeClient.update())
-    {
-    case 0:
-      platformManager.Blink(3, 500);
-      wifiManager.TurnWifiOn();
-      break;
-    case 2:
-      eventLogger.LogEvent(F("RTC synced."));
-      break;
-    default:
-      platformManager.Blink();
-      break;
-    }
-  }
+void setSunTimes(SunTimes &sunTimes)
+{
+  float lat, lng; // lat: 44.3316998, lng: 7.4774379
+  persistentConfiguration.GetCoordinates(lat, lng);
+  float tzOffset = persistentConfiguration.GetTimezoneOffset();
+  SunclockF sunclock(lat, lng, tzOffset);
+  SunDay sunDay;
+  const TimeSnapshot &now = timeClient.getSnapshot();
+  sunTimes.day = now.day;
+  // Sunclock takes UTC and evaluates the day at that instant: always local noon of today,
+  // whichever time the plan is compiled at (now.epoch is local time)
+  sunclock.sun_days((time_t)now.day * SECONDS_PER_DAY + SECONDS_PER_DAY / 2 - (time_t)(tzOffset * 3600), &sunDay, 1);
+  sunTimes.set = sunDay.set;
+  sunTimes.rise = sunDay.rise;
 
-  wifiManager.WifiHousekeeping();
+  // Solved once here rather than evaluating irradiance on every loop. Never reached, both
+  // crossings collapse on solar noon (dark all day); never left, they fall outside the day
+  SunRiseSet crossings = sunclock.irradiance_crossings(sunDay, persistentConfiguration.GetIrradianceThreshold());
+  sunTimes.irradianceRise = crossings.rise;
+  sunTimes.irradianceSet = crossings.set;
+
+  LOGDEBUG(F("Current time (GMT): "));
+  LOGDEBUGLN(timeClient.getFormattedTime());
+  printTime(sunTimes.set);
+  printTime(sunTimes.rise);
+  printTime(sunTimes.irradianceRise);
+  printTime(sunTimes.irradianceSet);
 }
 
 ICACHE_RAM_ATTR void wifiOnISR()
@@ -165,13 +265,13 @@ ICACHE_RAM_ATTR void wifiOnISR()
     return;
   lastInterruptTime = millis();
 
-  // Do the thing
-  if (!wifiManager.IsWifiOn())
-  {
-    wifiManager.TurnWifiOn();
-    platformManager.BlinkOn();
-    eventLogger.LogEvent(F("Requested WiFi ON."));
-  }
+  // Only queue the input: logging, the led and WiFi are handled by the loop
+  inputQueue.Push({INPUT_WIFI_BUTTON, lastInterruptTime});
+
+  // Wake up the main loop
+  inputTask.Wake();
+  wakeRequested = true;
+  esp_schedule();
 }
 
 /**
@@ -180,10 +280,11 @@ ICACHE_RAM_ATTR void wifiOnISR()
 void printTime(time_t time)
 {
 #ifdef DEBUG
-  std::tm *ptm = std::localtime(&time);
+  std::tm tm;
+  civil_time(time, tm);
   char buffer[32];
   memset(buffer, 0, sizeof(buffer) - 1);
-  std::strftime(buffer, 32, "%a, %d.%m.%Y %H:%M:%S (GMT)", ptm);
+  std::strftime(buffer, 32, "%a, %d.%m.%Y %H:%M:%S (GMT)", &tm);
   Serial.println(buffer);
 #endif
 }
@@ -0,0 +1,243 @@
+#ifndef LAMPSCHEDULE_HPP
+#define LAMPSCHEDULE_HPP
+
+#include <ctime>
+#include "PersistentConfiguration.hpp"
+#include "CivilTime.hpp"
+#include "constants.h"
+
+/**
+ * Daily lamp plan: the timer intervals of the configuration that apply to the day,
+ * resolved against its sun times and compiled into a sorted array of transitions, each
+ * holding the state word of all the channels from that instant on.
+ * Compile once a day and on configuration change, then query with a binary search.
+ */
+class LampSchedule
+{
+public:
+    LampSchedule();
+
+    /**
+     * Resolves and merges the intervals into transitions
+     */
+    void Compile(PersistentConfiguration *persistentConfiguration, const SunTimes &sunTimes);
+
+    /**
+     * @param secondOfDay seconds since midnight
+     * @return state of all channels at the given time, bit set if the lamp is on
+     */
+    ChannelMask GetState(long secondOfDay);
+
+    /**
+     * @param secondOfDay seconds since midnight
+     * @return second of day of the first transition after the given time,
+     * SECONDS_PER_DAY if there is none until midnight
+     */
+    long NextTransition(long secondOfDay);
+
+    /**
+     * Resolves an interval against the sun times of the day.
+     *
+     * @param on, off set to seconds since midnight, off is inclusive
+     * @return false if the interval never matches, or does not apply to the day
+     */
+    static bool ResolveInterval(const TimerInterval &ti, const SunTimes &sunTimes, long &on, long &off);
+
+    /**
+     * @return channels driven by the interval
+     */
+    static ChannelMask IntervalChannels(const TimerInterval &ti);
+
+    /**
+     * @param day days since 1970-01-01
+     * @return true unless the weekday mask or the skipped dates of the interval exclude the day
+     */
+    static bool AppliesOn(const TimerInterval &ti, long day);
+
+private:
+    typedef struct
+    {
+        long second; // Seconds since midnight
+        ChannelMask state;
+    } Transition;
+
+    typedef struct
+    {
+        long second;
+        ChannelMask channels;
+        bool on;
+    } Edge;
+
+    Transition _transitions[2 * NUM_INTERVALS];
+    int _numTransitions = 0;
+
+    static long ResolveTime(TimeType type, bool isOnTime, const SunTimes &sunTimes, const std::tm &exactTime);
+
+    /**
+     * Sun times can fall on another day at high latitudes (sunset after midnight, polar day):
+     * @return seconds since midnight, -1 before the day, SECONDS_PER_DAY after it
+     */
+    static long SunSecondOfDay(time_t time, long day);
+
+    /**
+     * @return index of the last transition at or before secondOfDay, -1 if none
+     */
+    int Find(long secondOfDay);
+};
+
+LampSchedule::LampSchedule()
+{
+}
+
+long LampSchedule::ResolveTime(TimeType type, bool isOnTime, const SunTimes &sunTimes, const std::tm &exactTime)
+{
+    switch (type)
+    {
+    case SUNRISE:
+        return SunSecondOfDay(sunTimes.rise, sunTimes.day);
+    case SUNSET:
+        return SunSecondOfDay(sunTimes.set, sunTimes.day);
+    case IRRADIANCE:
+        return SunSecondOfDay(isOnTime ? sunTimes.irradianceSet : sunTimes.irradianceRise, sunTimes.day);
+    default:
+        return exactTime.tm_hour * 60L * 60 + exactTime.tm_min * 60 + exactTime.tm_sec;
+    }
+}
+
+long LampSchedule::SunSecondOfDay(time_t time, long day)
+{
+    long timeDay = days_from_time(time);
+    return timeDay < day ? -1 : timeDay > day ? SECONDS_PER_DAY : seconds_of_day(time);
+}
+
+bool LampSchedule::AppliesOn(const TimerInterval &ti, long day)
+{
+    if (ti.weekdays && !(ti.weekdays >> weekday(day) & 1))
+        return false;
+
+    if (ti.skipFrom && ti.skipTo)
+    {
+        CivilDate date = civil_from_days(day);
+        unsigned int monthDay = date.month * 100 + date.day;
+        bool skipped = ti.skipFrom <= ti.skipTo ? monthDay >= ti.skipFrom && monthDay <= ti.skipTo
+                                                : monthDay >= ti.skipFrom || monthDay <= ti.skipTo;
+        if (skipped)
+            return false;
+    }
+
+    return true;
+}
+
+bool LampSchedule::ResolveInterval(const TimerInterval &ti, const SunTimes &sunTimes, long &on, long &off)
+{
+    if (!AppliesOn(ti, sunTimes.day))
+        return false;
+
+    on = ResolveTime(ti.onType, true, sunTimes, ti.on);
+    off = ResolveTime(ti.offType, false, sunTimes, ti.off);
+
+    // Handle edge case of off time = midnight
+    if (off < 60 && on >= 60)
+        off = SECONDS_PER_DAY - 1;
+
+    // An off time after the day ends the interval at midnight, an on time after it never comes
+    if (off >= SECONDS_PER_DAY)
+        off = SECONDS_PER_DAY - 1;
+
+    // Off time is intentionally inclusive; intervals ending before they start never match
+    return on <= off;
+}
+
+ChannelMask LampSchedule::IntervalChannels(const TimerInterval &ti)
+{
+    // Bits of channels this build does not have are ignored, and no channel left falls back to channel 1
+    ChannelMask channels = ti.channels & ((1UL << NUM_CHANNELS) - 1);
+    return channels ? channels : 1;
+}
+
+void LampSchedule::Compile(PersistentConfiguration *persistentConfiguration, const SunTimes &sunTimes)
+{
+    Edge edges[2 * NUM_INTERVALS];
+    int numEdges = 0;
+
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        TimerInterval ti = persistentConfiguration->GetTimerInterval(i);
+        long on, off;
+        if (!ResolveInterval(ti, sunTimes, on, off))
+            continue;
+
+        Edge onEdge = {on, IntervalChannels(ti), true};
+        Edge offEdge = {off + 1, onEdge.channels, false};
+        Edge newEdges[] = {onEdge, offEdge};
+
+        // Insertion sort by time, there are only a few intervals
+        for (const Edge &edge : newEdges)
+        {
+            int j = numEdges++;
+            for (; j > 0 && edges[j - 1].second > edge.second; j--)
+                edges[j] = edges[j - 1];
+            edges[j] = edge;
+        }
+    }
+
+    // Sweep the edges counting the active intervals per channel: ON state is privileged,
+    // so a channel is on while at least one of its intervals is
+    uint8_t active[NUM_CHANNELS] = {0};
+    ChannelMask state = 0;
+    _numTransitions = 0;
+    for (int i = 0; i < numEdges; i++)
+    {
+        for (int channel = 0; channel < NUM_CHANNELS; channel++)
+        {
+            if (!(edges[i].channels >> channel & 1))
+                continue;
+
+            active[channel] += edges[i].on ? 1 : -1;
+            if (active[channel])
+                state |= 1 << channel;
+            else
+                state &= ~(1 << channel);
+        }
+
+        // Coincident edges collapse in a single transition
+        if (i + 1 < numEdges && edges[i + 1].second == edges[i].second)
+            continue;
+
+        ChannelMask previous = _numTransitions ? _transitions[_numTransitions - 1].state : 0;
+        if (state == previous)
+            continue;
+
+        _transitions[_numTransitions].second = edges[i].second;
+        _transitions[_numTransitions++].state = state;
+    }
+}
+
+int LampSchedule::Find(long secondOfDay)
+{
+    int low = 0, high = _numTransitions;
+    while (low < high)
+    {
+        int mid = (low + high) / 2;
+        if (_transitions[mid].second <= secondOfDay)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return low - 1;
+}
+
+ChannelMask LampSchedule::GetState(long secondOfDay)
+{
+    int i = Find(secondOfDay);
+    return i >= 0 ? _transitions[i].state : 0;
+}
+
+long LampSchedule::NextTransition(long secondOfDay)
+{
+    int i = Find(secondOfDay) + 1;
+    return i < _numTransitions ? _transitions[i].second : SECONDS_PER_DAY;
+}
+
+#endif
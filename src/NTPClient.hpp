@@ -24,31 +24,100 @@
 #define NTPCLIENT_HPP
 
 #include "Arduino.h"
+#include "CivilTime.hpp"
 #include "debug.h"
 
 #include <Udp.h>
+#include <ESP8266WiFi.h>
+#include <lwip/dns.h>
 
 #define SEVENZYYEARS 2208988800UL
 #define NTP_PACKET_SIZE 48
 #define NTP_DEFAULT_LOCAL_PORT 1337
+#define NTP_TIMEOUT 1000       // ms to wait for a response
+#define NTP_MAX_ATTEMPTS 3     // Requests sent before update() fails
+#define NTP_POLL_INTERVAL 10   // ms between polls of a pending response
+#define NTP_MIN_UPDATE_INTERVAL 3600000UL // ms, the update interval adapts up to _updateInterval
+#define NTP_ACCURACY 100       // ms, target accuracy of the time between updates
+#define NTP_MAX_DRIFT 500e-6f  // Bound of the estimated millis() frequency error
+#define NTP_MAX_SERVERS 4      // Servers queried together in pool mode
+#define NTP_DNS_TTL 691200000UL // ms a resolved server address is reused, 8 days: longer than the update interval
+#define NTP_DNS_TIMEOUT 3000   // ms to wait for the lookups before querying the servers already resolved
+
+/**
+ * One reading of the clock, broken down. All the fields refer to the same instant,
+ * in local time (with the time offset).
+ */
+struct TimeSnapshot {
+  uint64_t      epochMillis;  // Milliseconds since Jan. 1, 1970
+  unsigned long epoch;        // Seconds since Jan. 1, 1970
+  long          day;          // Days since Jan. 1, 1970
+  long          secondOfDay;
+  int           millisecond;
+  CivilDate     date;
+  int           weekday;      // 0 is Sunday
+  int           hours;
+  int           minutes;
+  int           seconds;
+};
 
 class NTPClient {
   private:
     UDP*          _udp;
     bool          _udpSetup       = false;
 
-    const char*   _poolServerName = "time.nist.gov"; // Default time server
+    struct NTPServer {
+      const char*   name;
+      IPAddress     address;
+      unsigned long resolvedAt;             // In ms
+      bool          resolved;
+      bool          lookup;                 // An asynchronous lookup is pending
+    };
+
+    struct NTPSample {
+      uint64_t      utc;                    // In ms, at received
+      unsigned long received;               // millis() at reception
+      long          roundTrip;              // In ms
+    };
+
+    NTPServer     _servers[NTP_MAX_SERVERS] = {{"time.nist.gov"}}; // Default time server
+    byte          _numServers     = 1;
     int           _port           = NTP_DEFAULT_LOCAL_PORT;
     int           _timeOffset     = 0;
 
-    unsigned int  _updateInterval = 60000;  // In ms
+    unsigned int  _updateInterval = 60000;  // In ms, maximum of the adaptive interval
+    unsigned long _adaptiveInterval = NTP_MIN_UPDATE_INTERVAL; // In ms
 
-    unsigned long _currentEpoc    = 0;      // In s
+    uint64_t      _currentEpocMs  = 0;      // In ms, UTC at _lastUpdate
     unsigned long _lastUpdate     = 0;      // In ms
+    float         _drift          = 0;      // Estimated millis() frequency error, e.g. 20e-6 if 20 ppm slow
+
+    bool          _resolving      = false;  // Waiting for the lookups before sending the request
+    unsigned long _resolveStarted = 0;      // In ms
+    bool          _waiting        = false;  // A request is pending
+    unsigned long _requestSent    = 0;      // In ms
+    byte          _attempts       = 0;
+    byte          _queried        = 0;      // Bit mask of the servers the request was sent to
+    byte          _replied        = 0;      // Bit mask of the servers that replied
+    NTPSample     _samples[NTP_MAX_SERVERS];
+
+    TimeSnapshot  _snapshot       = {0, 0, -1};
 
     byte          _packetBuffer[NTP_PACKET_SIZE];
 
-    void          sendNTPPacket();
+    void          sendNTPPacket(byte server);
+    bool          resolveServers();
+    int           pollLookups();
+    int           sendRequest();
+    int           pollResponse();
+    void          readReply(int size, unsigned long received);
+    int           selectSample();
+    void          applySample(const NTPSample& sample);
+    unsigned long getUpdateInterval();
+    uint64_t      getUtcMillis(unsigned long now);
+    void          discipline(long error, unsigned long elapsed, long roundTrip);
+    static uint64_t readTimestamp(const byte* timestamp);
+    static void   dnsFound(const char* name, const ip_addr_t* address, void* arg);
 
   public:
     NTPClient(UDP& udp);
@@ -57,6 +126,15 @@ class NTPClient {
     NTPClient(UDP& udp, const char* poolServerName, int timeOffset);
     NTPClient(UDP& udp, const char* poolServerName, int timeOffset, int updateInterval);
 
+    /**
+     * Pool mode: every update queries all the given servers at once, over the same socket,
+     * and keeps the best reply. Resolved addresses are reused for NTP_DNS_TTL ms, or until
+     * the server misses a reply.
+     *
+     * @param names up to NTP_MAX_SERVERS host names, must outlive the client
+     */
+    void setPoolServerNames(const char* const* names, byte count);
+
     /**
      * Starts the underlying UDP client with the default local port
      */
@@ -70,23 +148,42 @@ class NTPClient {
     /**
      * This should be called in the main loop of your application. By default an update from the NTP Server is only
      * made every 60 seconds. This can be configured in the NTPClient constructor.
+     * Never waits: the servers are looked up asynchronously when needed, a request is sent on
+     * a later call and its response collected on yet another one, retrying up to
+     * NTP_MAX_ATTEMPTS times after NTP_TIMEOUT ms without response.
      *
-     * @return 1 on success, 2 on success and sync, 0 on failure
+     * @return 1 on success or while the response is pending, 2 on success and sync, 0 on failure
      */
     int update();
 
     /**
-     * This will force the update from the NTP Server.
+     * This will start an update from the NTP Server now, the outcome is returned by update().
      *
-     * @return 1 on success, 2 on success and sync, 0 on failure
+     * @return 1 on success, 0 on failure
      */
     int forceUpdate();
 
+    /**
+     * @return true while a lookup or a response from the NTP Server is pending
+     */
+    bool isUpdating();
+
     int getDay();
     int getHours();
     int getMinutes();
     int getSeconds();
 
+    /**
+     * @return milliseconds elapsed in the current second
+     */
+    int getMilliseconds();
+
+    /**
+     * @return milliseconds until update() will query the NTP Server (or poll the pending
+     * response), 0 if it is due
+     */
+    unsigned long getMillisToUpdate();
+
     /**
      * Changes the time offset. Useful for changing timezones dynamically
      */
@@ -94,10 +191,20 @@ class NTPClient {
 
     /**
      * Set the update interval to another frequency. E.g. useful when the
-     * timeOffset should not be set in the constructor
+     * timeOffset should not be set in the constructor.
+     * The actual interval starts at NTP_MIN_UPDATE_INTERVAL and doubles up to this one
+     * while the clock stays within NTP_ACCURACY between updates.
      */
     void setUpdateInterval(int updateInterval);
 
+    /**
+     * Sets the time as if it was just received from the NTP Server, without querying it.
+     * Lets a simulated clock drive the firmware.
+     *
+     * @param secs seconds since Jan. 1, 1970, without time offset
+     */
+    void setEpochTime(unsigned long secs);
+
     /**
      * @return time formatted like `hh:mm:ss`
      */
@@ -108,6 +215,23 @@ class NTPClient {
      */
     unsigned long getEpochTime();
 
+    /**
+     * @return time in milliseconds since Jan. 1, 1970, corrected for the estimated drift
+     * of millis() since the last update
+     */
+    uint64_t getEpochMillis();
+
+    /**
+     * Reads the clock into the snapshot returned by getSnapshot(), once per loop pass.
+     * The date is recomputed only when the day changes. Also called when the clock is set.
+     */
+    void takeSnapshot();
+
+    /**
+     * @return the last reading of the clock, shared by all its consumers
+     */
+    const TimeSnapshot& getSnapshot();
+
     /**
      * Stops the underlying UDP client
      */
@@ -126,22 +250,31 @@ NTPClient::NTPClient(UDP& udp, int timeOffset) {
 
 NTPClient::NTPClient(UDP& udp, const char* poolServerName) {
   this->_udp            = &udp;
-  this->_poolServerName = poolServerName;
+  this->_servers[0].name = poolServerName;
 }
 
 NTPClient::NTPClient(UDP& udp, const char* poolServerName, int timeOffset) {
   this->_udp            = &udp;
   this->_timeOffset     = timeOffset;
-  this->_poolServerName = poolServerName;
+  this->_servers[0].name = poolServerName;
 }
 
 NTPClient::NTPClient(UDP& udp, const char* poolServerName, int timeOffset, int updateInterval) {
   this->_udp            = &udp;
   this->_timeOffset     = timeOffset;
-  this->_poolServerName = poolServerName;
+  this->_servers[0].name = poolServerName;
   this->_updateInterval = updateInterval;
 }
 
+void NTPClient::setPoolServerNames(const char* const* names, byte count) {
+  if (count > NTP_MAX_SERVERS) count = NTP_MAX_SERVERS;
+  for (byte i = 0; i < count; i++) {
+    this->_servers[i].name     = names[i];
+    this->_servers[i].resolved = false;
+  }
+  this->_numServers = count;
+}
+
 void NTPClient::begin() {
   this->begin(NTP_DEFAULT_LOCAL_PORT);
 }
@@ -157,50 +290,233 @@ void NTPClient::begin(int port) {
 int NTPClient::forceUpdate() {
   LOGDEBUGLN(F("Update from NTP Server"));
 
+  if (!this->_udpSetup) this->begin();                           // setup the UDP client if needed
+  this->_attempts = 0;
+  if (this->resolveServers()) return 1;                          // The request is sent once they are done
+  return this->sendRequest();
+}
+
+/**
+ * Starts a lookup for each server whose address is missing or expired, unless one is
+ * already pending. lwIP answers from its cache at once, or calls dnsFound() later.
+ *
+ * @return true if any lookup is pending
+ */
+bool NTPClient::resolveServers() {
+  this->_resolving = false;
+  for (byte i = 0; i < this->_numServers; i++) {
+    NTPServer& s = this->_servers[i];
+    if (!s.lookup && (!s.resolved || millis() - s.resolvedAt >= NTP_DNS_TTL)) {
+      ip_addr_t address;
+      err_t err = dns_gethostbyname(s.name, &address, dnsFound, &s);
+      if (err == ERR_OK) dnsFound(s.name, &address, &s);
+      else s.lookup = err == ERR_INPROGRESS;
+    }
+    this->_resolving |= s.lookup;
+  }
+
+  this->_resolveStarted = millis();
+  return this->_resolving;
+}
+
+/**
+ * Called by lwIP with the address of a server, NULL if the lookup failed: the stale
+ * address, if any, is kept.
+ */
+void NTPClient::dnsFound(const char* name, const ip_addr_t* address, void* arg) {
+  NTPServer& s = *(NTPServer*)arg;
+  s.lookup = false;
+  if (!address || strcmp(name, s.name) != 0) return; // The names may have changed meanwhile
+  s.address    = IPAddress(address);
+  s.resolvedAt = millis();
+  s.resolved   = true;
+}
+
+int NTPClient::pollLookups() {
+  bool pending = false;
+  for (byte i = 0; i < this->_numServers; i++) pending |= this->_servers[i].lookup;
+  if (pending && millis() - this->_resolveStarted < NTP_DNS_TIMEOUT) return 1;
+
+  // The servers still unresolved are skipped, a late answer is kept for the next update
+  this->_resolving = false;
+  return this->sendRequest();
+}
+
+int NTPClient::sendRequest() {
   // Clear eventual previous buffered packets which have timed out
   while (this->_udp->parsePacket());
 
-  // Send packet
-  this->sendNTPPacket();
+  // Send packets, to all the servers at once
+  this->_requestSent = millis();
+  this->_queried     = 0;
+  this->_replied     = 0;
+  for (byte i = 0; i < this->_numServers; i++) {
+    if (this->_servers[i].resolved) {
+      this->sendNTPPacket(i);
+      this->_queried |= 1 << i;
+    }
+  }
 
-  // Wait till data is there or timeout...
-  byte timeout = 0;
-  int cb = 0;
-  do {
-    delay ( 10 );
-    cb = this->_udp->parsePacket();
-    if (timeout > 100) return 0; // timeout after 1000 ms
-    timeout++;
-  } while (cb == 0);
+  this->_attempts++;
+  this->_waiting = this->_queried != 0;
+  return this->_waiting ? 1 : 0;
+}
 
-  this->_lastUpdate = millis() - (10 * (timeout + 1)); // Account for delay in reading the time
+int NTPClient::pollResponse() {
+  int size;
+  while ((size = this->_udp->parsePacket()) > 0) this->readReply(size, millis());
 
-  this->_udp->read(this->_packetBuffer, NTP_PACKET_SIZE);
+  // Wait for all the servers, up to the timeout
+  if (this->_replied != this->_queried && millis() - this->_requestSent < NTP_TIMEOUT) return 1;
 
-  unsigned long highWord = word(this->_packetBuffer[40], this->_packetBuffer[41]);
-  unsigned long lowWord = word(this->_packetBuffer[42], this->_packetBuffer[43]);
-  // combine the four bytes (two words) into a long integer
-  // this is NTP time (seconds since Jan 1 1900):
-  unsigned long secsSince1900 = highWord << 16 | lowWord;
+  // A server that did not reply is looked up again at the next update: the pool may have retired it
+  for (byte i = 0; i < this->_numServers; i++) {
+    if (this->_queried >> i & ~this->_replied >> i & 1) this->_servers[i].resolvedAt = millis() - NTP_DNS_TTL;
+  }
 
-  this->_currentEpoc = secsSince1900 - SEVENZYYEARS;
+  if (!this->_replied) {
+    if (this->_attempts < NTP_MAX_ATTEMPTS) return this->sendRequest();
+    this->_waiting = false;
+    return 0;
+  }
 
+  this->_waiting = false;
+  this->applySample(this->_samples[this->selectSample()]);
   return 2;
 }
 
+void NTPClient::readReply(int size, unsigned long received) {
+  this->_udp->read(this->_packetBuffer, NTP_PACKET_SIZE);
+
+  // Accept only a server reply (mode 4) to our last request, from a synchronized server:
+  // the originate timestamp echoes the transmit timestamp of the request, holding the
+  // time it was sent and the index of the server
+  byte leap = this->_packetBuffer[0] >> 6, mode = this->_packetBuffer[0] & 0x07, stratum = this->_packetBuffer[1];
+  uint32_t requestStamp = this->_requestSent;
+  byte server = this->_packetBuffer[28];
+  if (size < NTP_PACKET_SIZE || mode != 4 || leap == 3 || stratum == 0 || stratum > 15 ||
+      memcmp(this->_packetBuffer + 24, &requestStamp, sizeof(requestStamp)) != 0 ||
+      server >= this->_numServers || !(this->_queried >> server & 1) || (this->_replied >> server & 1)) {
+    LOGDEBUGLN(F("Discarded NTP packet"));
+    return;
+  }
+
+  // Four timestamps: request sent (t1) and received (t4) by us, in millis(),
+  // request received (t2) and reply sent (t3) by the server, in UTC
+  uint64_t t2 = readTimestamp(this->_packetBuffer + 32);
+  uint64_t t3 = readTimestamp(this->_packetBuffer + 40);
+  NTPSample& sample = this->_samples[server];
+  sample.received  = received;
+  sample.roundTrip = (long)(received - this->_requestSent) - (long)(t3 - t2);
+  if (sample.roundTrip < 0) sample.roundTrip = 0;
+  sample.utc = t3 + sample.roundTrip / 2; // UTC at t4
+  this->_replied |= 1 << server;
+}
+
+/**
+ * Each reply bounds the offset between UTC and millis() within half its round trip.
+ * Keeps the replies whose bounds overlap with the most others, so a server off by more
+ * than the network delays is outvoted, and among them the one with the lowest round trip.
+ *
+ * @return index of the selected sample
+ */
+int NTPClient::selectSample() {
+  int best = -1, bestAgreement = 0;
+  for (byte i = 0; i < this->_numServers; i++) {
+    if (!(this->_replied >> i & 1)) continue;
+
+    int agreement = 0;
+    for (byte j = 0; j < this->_numServers; j++) {
+      if (!(this->_replied >> j & 1)) continue;
+      long difference = (long)(int64_t)(this->_samples[i].utc - this->_samples[j].utc) -
+                        (long)(this->_samples[i].received - this->_samples[j].received);
+      if (labs(difference) <= (this->_samples[i].roundTrip + this->_samples[j].roundTrip) / 2 + 1) agreement++;
+    }
+
+    if (agreement > bestAgreement ||
+        (agreement == bestAgreement && this->_samples[i].roundTrip < this->_samples[best].roundTrip)) {
+      best          = i;
+      bestAgreement = agreement;
+    }
+  }
+
+  return best;
+}
+
+void NTPClient::applySample(const NTPSample& sample) {
+  if (this->_lastUpdate != 0) {
+    long error = (long)(int64_t)(sample.utc - this->getUtcMillis(sample.received));
+    this->discipline(error, sample.received - this->_lastUpdate, sample.roundTrip);
+  }
+
+  this->_currentEpocMs = sample.utc;
+  this->_lastUpdate    = sample.received;
+  this->takeSnapshot();
+  LOGDEBUGLN("NTP delay: " + String(sample.roundTrip) + " ms, drift: " + String(this->_drift * 1e6f, 1) +
+             " ppm, next update in " + String(this->getUpdateInterval() / 60000) + " min");
+}
+
+/**
+ * Corrects the drift estimate with the error accumulated since the last update, and
+ * adapts the update interval: longer while the error stays well within NTP_ACCURACY.
+ * Up to half the round trip the error may be due to asymmetric network delays, so it
+ * does not shorten the interval.
+ */
+void NTPClient::discipline(long error, unsigned long elapsed, long roundTrip) {
+  // Over short intervals the error is dominated by the network delay
+  if (elapsed >= NTP_MIN_UPDATE_INTERVAL / 4) {
+    this->_drift += 0.5f * error / elapsed;
+    if (this->_drift > NTP_MAX_DRIFT) this->_drift = NTP_MAX_DRIFT;
+    if (this->_drift < -NTP_MAX_DRIFT) this->_drift = -NTP_MAX_DRIFT;
+  }
+
+  unsigned long absError = error < 0 ? -error : error;
+  absError = absError > (unsigned long)roundTrip / 2 ? absError - roundTrip / 2 : 0;
+  if (absError < NTP_ACCURACY / 4 && this->_adaptiveInterval < this->_updateInterval) {
+    this->_adaptiveInterval *= 2;
+  } else if (absError > NTP_ACCURACY / 2 && this->_adaptiveInterval > NTP_MIN_UPDATE_INTERVAL) {
+    this->_adaptiveInterval /= 2;
+  }
+}
+
+unsigned long NTPClient::getUpdateInterval() {
+  return this->_adaptiveInterval < this->_updateInterval ? this->_adaptiveInterval : this->_updateInterval;
+}
+
+uint64_t NTPClient::readTimestamp(const byte* timestamp) {
+  uint64_t seconds = (uint64_t)timestamp[0] << 24 | (uint32_t)timestamp[1] << 16 | timestamp[2] << 8 | timestamp[3];
+  uint32_t fraction = (uint32_t)timestamp[4] << 24 | (uint32_t)timestamp[5] << 16 | timestamp[6] << 8 | timestamp[7];
+  if (seconds < SEVENZYYEARS) seconds += 1ULL << 32;  // NTP era 1, from 2036
+  return (seconds - SEVENZYYEARS) * 1000 + (((uint64_t)fraction * 1000) >> 32);
+}
+
 int NTPClient::update() {
-  if ((millis() - this->_lastUpdate >= this->_updateInterval)     // Update after _updateInterval
+  if (this->_resolving) return this->pollLookups();
+  if (this->_waiting) return this->pollResponse();
+  if ((millis() - this->_lastUpdate >= this->getUpdateInterval()) // Update after the update interval
     || this->_lastUpdate == 0) {                                // Update if there was no update yet.
-    if (!this->_udpSetup) this->begin();                         // setup the UDP client if needed
     return this->forceUpdate();
   }
   return 1;
 }
 
+bool NTPClient::isUpdating() {
+  return this->_resolving || this->_waiting;
+}
+
+uint64_t NTPClient::getUtcMillis(unsigned long now) {
+  unsigned long elapsed = now - this->_lastUpdate;
+  return this->_currentEpocMs + // Epoc returned by the NTP server
+         elapsed +              // Time since last update
+         (int64_t)(elapsed * this->_drift);
+}
+
+uint64_t NTPClient::getEpochMillis() {
+  return this->getUtcMillis(millis()) + this->_timeOffset * 1000LL; // User offset
+}
+
 unsigned long NTPClient::getEpochTime() {
-  return this->_timeOffset + // User offset
-         this->_currentEpoc + // Epoc returned by the NTP server
-         ((millis() - this->_lastUpdate) / 1000); // Time since last update
+  return this->getEpochMillis() / 1000;
 }
 
 int NTPClient::getDay() {
@@ -216,18 +532,22 @@ int NTPClient::getSeconds() {
   return (this->getEpochTime() % 60);
 }
 
-String NTPClient::getFormattedTime() {
-  unsigned long rawTime = this->getEpochTime();
-  unsigned long hours = (rawTime % 86400L) / 3600;
-  String hoursStr = hours < 10 ? "0" + String(hours) : String(hours);
-
-  unsigned long minutes = (rawTime % 3600) / 60;
-  String minuteStr = minutes < 10 ? "0" + String(minutes) : String(minutes);
+int NTPClient::getMilliseconds() {
+  return this->getEpochMillis() % 1000;
+}
 
-  unsigned long seconds = rawTime % 60;
-  String secondStr = seconds < 10 ? "0" + String(seconds) : String(seconds);
+unsigned long NTPClient::getMillisToUpdate() {
+  if (this->_resolving || this->_waiting) return NTP_POLL_INTERVAL;
+  unsigned long elapsed = millis() - this->_lastUpdate;
+  if (this->_lastUpdate == 0 || elapsed >= this->getUpdateInterval()) return 0;
+  return this->getUpdateInterval() - elapsed;
+}
 
-  return hoursStr + ":" + minuteStr + ":" + secondStr;
+String NTPClient::getFormattedTime() {
+  unsigned long rawTime = this->getEpochTime();
+  char buffer[sizeof("hh:mm:ss")];
+  snprintf(buffer, sizeof(buffer), "%02lu:%02lu:%02lu", (rawTime % 86400L) / 3600, (rawTime % 3600) / 60, rawTime % 60);
+  return String(buffer);
 }
 
 void NTPClient::end() {
@@ -244,7 +564,39 @@ void NTPClient::setUpdateInterval(int updateInterval) {
   this->_updateInterval = updateInterval;
 }
 
-void NTPClient::sendNTPPacket() {
+void NTPClient::setEpochTime(unsigned long secs) {
+  this->_currentEpocMs = secs * 1000ULL;
+  this->_lastUpdate    = millis();
+  this->takeSnapshot();
+}
+
+void NTPClient::takeSnapshot() {
+  TimeSnapshot& s = this->_snapshot;
+  s.epochMillis = this->getEpochMillis();
+  s.millisecond = s.epochMillis % 1000;
+
+  unsigned long epoch = s.epochMillis / 1000;
+  if (epoch == s.epoch && s.day >= 0) return;
+  s.epoch = epoch;
+
+  long day = days_from_time(epoch);
+  if (day != s.day) {
+    s.day     = day;
+    s.date    = civil_from_days(day);
+    s.weekday = weekday(day);
+  }
+
+  s.secondOfDay = epoch - day * SECONDS_PER_DAY;
+  s.hours       = s.secondOfDay / 3600;
+  s.minutes     = s.secondOfDay / 60 % 60;
+  s.seconds     = s.secondOfDay % 60;
+}
+
+const TimeSnapshot& NTPClient::getSnapshot() {
+  return this->_snapshot;
+}
+
+void NTPClient::sendNTPPacket(byte server) {
   // set all bytes in the buffer to 0
   memset(this->_packetBuffer, 0, NTP_PACKET_SIZE);
   // Initialize values needed to form NTP request
@@ -258,10 +610,14 @@ void NTPClient::sendNTPPacket() {
   this->_packetBuffer[13]  = 0x4E;
   this->_packetBuffer[14]  = 49;
   this->_packetBuffer[15]  = 52;
+  // Transmit timestamp, only echoed back by the server as originate timestamp to match the reply
+  uint32_t requestStamp = this->_requestSent;
+  memcpy(this->_packetBuffer + 40, &requestStamp, sizeof(requestStamp));
+  this->_packetBuffer[44]  = server;
 
   // all NTP fields have been given values, now
   // you can send a packet requesting a timestamp:
-  this->_udp->beginPacket(this->_poolServerName, 123); //NTP requests are to port 123
+  this->_udp->beginPacket(this->_servers[server].address, 123); //NTP requests are to port 123
   this->_udp->write(this->_packetBuffer, NTP_PACKET_SIZE);
   this->_udp->endPacket();
 }
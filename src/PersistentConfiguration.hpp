@@ -4,27 +4,67 @@
 #include <ctime>
 #include <EEPROM.h>
 #include <Arduino.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "Crc.hpp"
+#include "FlashStorage.hpp"
 #include "constants.h"
+#include "debug.h"
 
 enum TimeType 
 {
     EXACT,
     SUNRISE,
-    SUNSET
+    SUNSET,
+    // Modeled irradiance crossing the configured threshold: as on time it is the
+    // evening (falling) crossing, as off time the morning (rising) crossing
+    IRRADIANCE
 };
 
+/**
+ * Times of the sun-dependent TimeTypes, resolved once a day
+ */
+typedef struct
+{
+    long day; // Days since 1970-01-01, in local time, the times refer to
+    time_t rise;
+    time_t set;
+    time_t irradianceRise; // Morning crossing of the irradiance threshold
+    time_t irradianceSet;  // Evening crossing of the irradiance threshold
+} SunTimes;
+
+// One bit per relay channel, bit 0 is channel 1
+typedef uint16_t ChannelMask;
+
+// Weekday mask of an interval disabled on every day: no weekday bit, but not 0
+#define NO_WEEKDAYS 0x80
+
 typedef struct
 {
     std::tm on;
     TimeType onType;
     std::tm off;
     TimeType offType;
+    ChannelMask channels; // No valid channel drives channel 1 only, as before channels were introduced
+    uint8_t weekdays;     // Bit 0 is Sunday, 0 is every day, NO_WEEKDAYS is none
+    uint16_t skipFrom;    // Dates the interval is skipped, as month * 100 + day, both
+    uint16_t skipTo;      // inclusive; the range wraps around new year if skipFrom > skipTo
 } TimerInterval;
 
+/**
+ * Configuration stored in two flash sectors used as A/B slots. A slot holds a header with
+ * schema version, generation and the CRC of a compact serialized image, followed by delta
+ * records with only the bytes changed by each save, each checked by its own CRC. The
+ * valid slot with the highest generation wins and its deltas apply up to the first
+ * invalid one, so a torn write loses at most the save being written. When a delta does not
+ * fit, the whole image is written to the other slot, whose header is written last.
+ * Without the two sectors (no filesystem partition) the header and image are kept in the
+ * EEPROM sector instead, rewritten whole on each save.
+ */
 class PersistentConfiguration
 {
 public:
-    PersistentConfiguration();
+    PersistentConfiguration(FlashStorage *const storage);
     String GetSSID();
     void SetSSID(const String &ssid);
     String GetPassword();
@@ -33,12 +73,73 @@ public:
     void SetCoordinates(const float &latitude, const float &longitude);
     float GetTimezoneOffset();
     void SetTimezoneOffset(const float &tzOffset);
+    float GetIrradianceThreshold();
+    void SetIrradianceThreshold(const float &irradianceThreshold);
     TimerInterval GetTimerInterval(unsigned int num);
     void SetTimerInterval(unsigned int num, TimerInterval timerInterval);
     void SaveConfiguration();
     void Reset();
 
+    /**
+     * @return a counter incremented on every save, to detect configuration changes
+     */
+    unsigned int GetRevision();
+
 private:
+    struct SlotHeader
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t size; // Of the image
+        uint32_t generation;
+        uint32_t crc; // Of the fields above and the image
+    };
+
+    static const uint32_t MAGIC = 0x464E4F43; // "CONF"
+    static const uint16_t VERSION = 1;
+    static const size_t INTERVAL_SIZE = 15;
+    static const size_t IMAGE_SIZE = 33 + 65 + 4 * 4 + INTERVAL_SIZE * NUM_INTERVALS;
+    static const size_t IMAGE_WORDS = (IMAGE_SIZE + 3) / 4;
+    static const size_t MAX_DELTA = 128; // Bigger changes rewrite the image
+    static const size_t DELTA_WORDS = 1 + (MAX_DELTA + 3) / 4 + 1;
+    static const uint32_t SLOT_SIZE = FlashStorage::FLASH_SECTOR_SIZE;
+    static_assert(sizeof(SlotHeader) + IMAGE_WORDS * sizeof(uint32_t) <= SLOT_SIZE, "The image does not fit in a slot");
+
+    FlashStorage *const _storage;
+    unsigned int _revision = 0;
+    uint32_t _slot = 1; // The first image goes to slot 0
+    uint32_t _generation = 0;
+    uint32_t _offset = SLOT_SIZE; // Of the next delta in the slot
+    uint32_t _image[IMAGE_WORDS]; // As stored
+
+    /**
+     * Layout written by EEPROM.put before the slots, read once to migrate. Frozen as the
+     * firmware before them wrote it: it must not follow TimerInterval or Conf.
+     */
+    struct LegacyTimerInterval
+    {
+        std::tm on;
+        TimeType onType;
+        std::tm off;
+        TimeType offType;
+    };
+
+    struct LegacyConf
+    {
+        char ssid[32 + 1];
+        char password[64 + 1];
+        float latitude;
+        float longitude;
+        float tzOffset;
+        LegacyTimerInterval timerIntervals[NUM_INTERVALS];
+    };
+
+    // The EEPROM sector holds the legacy configuration, or the image without the slots
+    static const size_t EEPROM_SIZE = sizeof(LegacyConf) > sizeof(SlotHeader) + IMAGE_WORDS * sizeof(uint32_t)
+                                          ? sizeof(LegacyConf)
+                                          : sizeof(SlotHeader) + IMAGE_WORDS * sizeof(uint32_t);
+    static_assert(EEPROM_SIZE <= FlashStorage::FLASH_SECTOR_SIZE, "The image does not fit in the EEPROM sector");
+
     struct Conf
     {
         char ssid[32 + 1];
@@ -47,13 +148,66 @@ private:
         float longitude;
         float tzOffset;
         TimerInterval timerIntervals[NUM_INTERVALS];
+        float irradianceThreshold;
     } _conf;
+
+    bool LoadSlot(uint32_t slot);
+    bool AppendDelta(const uint8_t *image);
+    void WriteSlot(const uint32_t *image);
+    bool LoadEeprom();
+    void WriteEeprom(const uint32_t *image);
+    void MigrateLegacy();
+    void Serialize(uint32_t *image);
+    void Deserialize(const uint8_t *image);
 };
 
-PersistentConfiguration::PersistentConfiguration()
+PersistentConfiguration::PersistentConfiguration(FlashStorage *const storage)
+    : _storage(storage)
 {
-    EEPROM.begin(sizeof(Conf));
-    EEPROM.get(0, _conf);
+    memset(&_conf, 0, sizeof(_conf));
+    memset(_image, 0, sizeof(_image));
+    if (_storage->Sectors() < 2)
+    {
+        LOGDEBUGLN(F("No flash sectors for the configuration slots, it is kept in EEPROM"));
+        if (LoadEeprom())
+        {
+            Deserialize((const uint8_t *)_image);
+            return;
+        }
+
+        MigrateLegacy();
+        uint32_t image[IMAGE_WORDS];
+        Serialize(image);
+        WriteEeprom(image);
+        return;
+    }
+
+    // Newest slot first, the other if the newest is damaged
+    SlotHeader headers[2];
+    for (uint32_t slot = 0; slot < 2; slot++)
+    {
+        if (!_storage->Read(slot * SLOT_SIZE, (uint32_t *)&headers[slot], sizeof(SlotHeader)) ||
+            headers[slot].magic != MAGIC)
+            headers[slot].generation = 0;
+    }
+
+    uint32_t newest = (int32_t)(headers[1].generation - headers[0].generation) > 0 ? 1 : 0;
+    if ((headers[newest].generation && LoadSlot(newest)) ||
+        (headers[newest ^ 1].generation && LoadSlot(newest ^ 1)))
+    {
+        Deserialize((const uint8_t *)_image);
+        return;
+    }
+
+    // First boot with the slots: carry over the EEPROM configuration, kept there by this
+    // firmware without the slots or by the one before them
+    if (LoadEeprom())
+        Deserialize((const uint8_t *)_image);
+    else
+        MigrateLegacy();
+    uint32_t image[IMAGE_WORDS];
+    Serialize(image);
+    WriteSlot(image);
 }
 
 String PersistentConfiguration::GetSSID()
@@ -100,6 +254,16 @@ void PersistentConfiguration::SetTimezoneOffset(const float &tzOffset)
     _conf.tzOffset = tzOffset;
 }
 
+float PersistentConfiguration::GetIrradianceThreshold()
+{
+    return _conf.irradianceThreshold;
+}
+
+void PersistentConfiguration::SetIrradianceThreshold(const float &irradianceThreshold)
+{
+    _conf.irradianceThreshold = irradianceThreshold;
+}
+
 TimerInterval PersistentConfiguration::GetTimerInterval(unsigned int num)
 {
     TimerInterval ti;
@@ -121,15 +285,349 @@ void PersistentConfiguration::SetTimerInterval(unsigned int num, TimerInterval t
 
 void PersistentConfiguration::SaveConfiguration()
 {
-    EEPROM.put(0, _conf);
-    EEPROM.commit();
+    _revision++;
+    uint32_t image[IMAGE_WORDS];
+    Serialize(image);
+    if (_storage->Sectors() < 2)
+    {
+        if (memcmp(image, _image, sizeof(_image)) != 0)
+            WriteEeprom(image);
+        return;
+    }
+
+    if (!AppendDelta((const uint8_t *)image))
+        WriteSlot(image);
+}
+
+unsigned int PersistentConfiguration::GetRevision()
+{
+    return _revision;
 }
 
 void PersistentConfiguration::Reset()
 {
-    Conf rstConf = {0};
-    EEPROM.put(0, rstConf);
-    EEPROM.commit();
+    memset(&_conf, 0, sizeof(_conf));
+    SaveConfiguration();
+}
+
+/**
+ * Reads the image of the slot into _image and applies its deltas.
+ *
+ * @return false if the slot is not valid
+ */
+bool PersistentConfiguration::LoadSlot(uint32_t slot)
+{
+    SlotHeader header;
+    uint32_t base = slot * SLOT_SIZE;
+    if (!_storage->Read(base, (uint32_t *)&header, sizeof(header)) ||
+        header.magic != MAGIC || header.version != VERSION || header.size > IMAGE_SIZE)
+        return false;
+
+    // An image shorter than ours, e.g. with fewer intervals, leaves the new fields zero
+    uint32_t imageSize = (header.size + 3) & ~3;
+    memset(_image, 0, sizeof(_image));
+    if (!_storage->Read(base + sizeof(header), _image, imageSize))
+        return false;
+    memset((uint8_t *)_image + header.size, 0, imageSize - header.size);
+
+    uint32_t crc = crc32(&header, offsetof(SlotHeader, crc));
+    if (header.crc != crc32(_image, header.size, crc))
+        return false;
+
+    // Apply the deltas up to the erased space, or up to a torn one: then the next save
+    // goes to the other slot, as the rest of this one may not be erased
+    uint32_t offset = sizeof(header) + imageSize;
+    uint32_t delta[DELTA_WORDS];
+    const uint8_t *bytes = (const uint8_t *)(delta + 1);
+    _offset = SLOT_SIZE;
+    while (offset + sizeof(uint32_t) <= SLOT_SIZE && _storage->Read(base + offset, delta, sizeof(uint32_t)))
+    {
+        if (delta[0] == 0xFFFFFFFF)
+        {
+            _offset = offset;
+            break;
+        }
+
+        uint32_t length = delta[0] & 0xFFFF;
+        uint32_t words = (length + 3) / 4;
+        uint32_t size = (words + 2) * sizeof(uint32_t);
+        if ((delta[0] >> 16) != (~length & 0xFFFF) || length > MAX_DELTA || offset + size > SLOT_SIZE ||
+            !_storage->Read(base + offset + sizeof(uint32_t), delta + 1, size - sizeof(uint32_t)) ||
+            delta[1 + words] != crc32(bytes, length))
+            break;
+
+        // Ranges of [offset low, offset high, length, bytes]
+        for (uint32_t i = 0; i + 3 <= length;)
+        {
+            uint32_t at = bytes[i] | (bytes[i + 1] << 8);
+            uint32_t count = bytes[i + 2];
+            i += 3;
+            if (i + count > length)
+                break;
+            if (at + count <= IMAGE_SIZE)
+                memcpy((uint8_t *)_image + at, bytes + i, count);
+            i += count;
+        }
+
+        offset += size;
+    }
+
+    _slot = slot;
+    _generation = header.generation;
+    LOGDEBUG(F("Configuration from slot "));
+    LOGDEBUG(slot);
+    LOGDEBUG(F(", generation "));
+    LOGDEBUGLN(_generation);
+    return true;
+}
+
+/**
+ * Appends the bytes of the image that differ from the stored one to the current slot.
+ *
+ * @return false if they do not fit, and the image has to be rewritten
+ */
+bool PersistentConfiguration::AppendDelta(const uint8_t *image)
+{
+    uint32_t delta[DELTA_WORDS];
+    uint8_t *bytes = (uint8_t *)(delta + 1);
+    const uint8_t *stored = (const uint8_t *)_image;
+    uint32_t length = 0;
+    for (uint32_t i = 0; i < IMAGE_SIZE;)
+    {
+        if (image[i] == stored[i])
+        {
+            i++;
+            continue;
+        }
+
+        // Bridge unchanged gaps shorter than the header of a new range
+        uint32_t end = i + 1;
+        for (uint32_t j = end; j < IMAGE_SIZE && j - end < 3 && j - i < 255; j++)
+        {
+            if (image[j] != stored[j])
+                end = j + 1;
+        }
+
+        uint32_t count = end - i;
+        if (length + 3 + count > MAX_DELTA)
+            return false;
+
+        bytes[length++] = i & 0xFF;
+        bytes[length++] = i >> 8;
+        bytes[length++] = count;
+        memcpy(bytes + length, image + i, count);
+        length += count;
+        i = end;
+    }
+
+    if (length == 0)
+        return true;
+
+    uint32_t words = (length + 3) / 4;
+    uint32_t size = (words + 2) * sizeof(uint32_t);
+    if (_offset + size > SLOT_SIZE)
+        return false;
+
+    memset(bytes + length, 0, words * sizeof(uint32_t) - length);
+    delta[0] = length | (~length << 16);
+    delta[1 + words] = crc32(bytes, length);
+    if (!_storage->Write(_slot * SLOT_SIZE + _offset, delta, size))
+        return false;
+
+    _offset += size;
+    memcpy(_image, image, IMAGE_SIZE);
+    return true;
+}
+
+/**
+ * Writes the image to the other slot, which becomes valid with its header.
+ */
+void PersistentConfiguration::WriteSlot(const uint32_t *image)
+{
+    SlotHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.size = IMAGE_SIZE;
+    header.generation = _generation + 1;
+    header.crc = crc32(image, IMAGE_SIZE, crc32(&header, offsetof(SlotHeader, crc)));
+
+    uint32_t slot = _slot ^ 1;
+    _storage->EraseSector(slot);
+    _storage->Write(slot * SLOT_SIZE + sizeof(header), image, IMAGE_WORDS * sizeof(uint32_t));
+    _storage->Write(slot * SLOT_SIZE, (const uint32_t *)&header, sizeof(header));
+
+    _slot = slot;
+    _generation = header.generation;
+    _offset = sizeof(header) + IMAGE_WORDS * sizeof(uint32_t);
+    memcpy(_image, image, sizeof(_image));
+}
+
+/**
+ * Reads the image kept in EEPROM without the slots into _image.
+ *
+ * @return false if there is none, or it is not valid
+ */
+bool PersistentConfiguration::LoadEeprom()
+{
+    SlotHeader header;
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.get(0, header);
+    bool valid = header.magic == MAGIC && header.version == VERSION && header.size <= IMAGE_SIZE;
+    if (valid)
+    {
+        memset(_image, 0, sizeof(_image));
+        for (uint32_t i = 0; i < header.size; i++)
+            ((uint8_t *)_image)[i] = EEPROM.read(sizeof(header) + i);
+        valid = header.crc == crc32(_image, header.size, crc32(&header, offsetof(SlotHeader, crc)));
+    }
+    EEPROM.end();
+
+    if (!valid)
+    {
+        memset(_image, 0, sizeof(_image));
+        return false;
+    }
+
+    LOGDEBUGLN(F("Configuration from EEPROM"));
+    return true;
+}
+
+/**
+ * Rewrites the EEPROM sector with the image. A torn write loses the configuration, as
+ * EEPROM.put did before the slots.
+ */
+void PersistentConfiguration::WriteEeprom(const uint32_t *image)
+{
+    SlotHeader header;
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.size = IMAGE_SIZE;
+    header.generation = 0;
+    header.crc = crc32(image, IMAGE_SIZE, crc32(&header, offsetof(SlotHeader, crc)));
+
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.put(0, header);
+    for (uint32_t i = 0; i < IMAGE_SIZE; i++)
+        EEPROM.write(sizeof(header) + i, ((const uint8_t *)image)[i]);
+    if (!EEPROM.end())
+        LOGDEBUGLN(F("Configuration not saved: EEPROM commit failed"));
+
+    memcpy(_image, image, sizeof(_image));
+}
+
+/**
+ * Reads the configuration of the firmware before the slots. The fields it did not have
+ * keep their defaults: no irradiance threshold, channel 1, every day, never skipped.
+ */
+void PersistentConfiguration::MigrateLegacy()
+{
+    LegacyConf legacy;
+    memset(&legacy, 0xFF, sizeof(legacy));
+    EEPROM.begin(EEPROM_SIZE);
+    EEPROM.get(0, legacy);
+    EEPROM.end();
+
+    // Never written, or a damaged image of LoadEeprom()
+    SlotHeader header;
+    memcpy(&header, &legacy, sizeof(header));
+    if ((uint8_t)legacy.ssid[0] == 0xFF || (header.magic == MAGIC && header.version == VERSION))
+        return;
+
+    LOGDEBUGLN(F("Migrating the EEPROM configuration"));
+    memcpy(_conf.ssid, legacy.ssid, sizeof(_conf.ssid));
+    memcpy(_conf.password, legacy.password, sizeof(_conf.password));
+    _conf.ssid[sizeof(_conf.ssid) - 1] = 0;
+    _conf.password[sizeof(_conf.password) - 1] = 0;
+    _conf.latitude = legacy.latitude;
+    _conf.longitude = legacy.longitude;
+    _conf.tzOffset = legacy.tzOffset;
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        const LegacyTimerInterval &from = legacy.timerIntervals[i];
+        TimerInterval &ti = _conf.timerIntervals[i];
+        ti.on = from.on;
+        ti.onType = from.onType <= SUNSET ? from.onType : EXACT;
+        ti.off = from.off;
+        ti.offType = from.offType <= SUNSET ? from.offType : EXACT;
+    }
+}
+
+/**
+ * Image layout (version 1): ssid[33], password[65], latitude, longitude, tzOffset,
+ * irradianceThreshold as floats, then per interval on hour, minute, second, type,
+ * off hour, minute, second, type, channels (2), weekdays, skipFrom (2), skipTo (2).
+ * Integers are little endian. The image is zero padded to whole words.
+ */
+void PersistentConfiguration::Serialize(uint32_t *image)
+{
+    memset(image, 0, IMAGE_WORDS * sizeof(uint32_t));
+    uint8_t *p = (uint8_t *)image;
+    memcpy(p, _conf.ssid, sizeof(_conf.ssid));
+    p += sizeof(_conf.ssid);
+    memcpy(p, _conf.password, sizeof(_conf.password));
+    p += sizeof(_conf.password);
+
+    const float floats[] = {_conf.latitude, _conf.longitude, _conf.tzOffset, _conf.irradianceThreshold};
+    memcpy(p, floats, sizeof(floats));
+    p += sizeof(floats);
+
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        const TimerInterval &ti = _conf.timerIntervals[i];
+        *p++ = ti.on.tm_hour;
+        *p++ = ti.on.tm_min;
+        *p++ = ti.on.tm_sec;
+        *p++ = ti.onType;
+        *p++ = ti.off.tm_hour;
+        *p++ = ti.off.tm_min;
+        *p++ = ti.off.tm_sec;
+        *p++ = ti.offType;
+        *p++ = ti.channels & 0xFF;
+        *p++ = ti.channels >> 8;
+        *p++ = ti.weekdays;
+        *p++ = ti.skipFrom & 0xFF;
+        *p++ = ti.skipFrom >> 8;
+        *p++ = ti.skipTo & 0xFF;
+        *p++ = ti.skipTo >> 8;
+    }
+}
+
+void PersistentConfiguration::Deserialize(const uint8_t *image)
+{
+    memset(&_conf, 0, sizeof(_conf));
+    const uint8_t *p = image;
+    memcpy(_conf.ssid, p, sizeof(_conf.ssid) - 1);
+    p += sizeof(_conf.ssid);
+    memcpy(_conf.password, p, sizeof(_conf.password) - 1);
+    p += sizeof(_conf.password);
+
+    float floats[4];
+    memcpy(floats, p, sizeof(floats));
+    p += sizeof(floats);
+    _conf.latitude = floats[0];
+    _conf.longitude = floats[1];
+    _conf.tzOffset = floats[2];
+    _conf.irradianceThreshold = floats[3];
+
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        TimerInterval &ti = _conf.timerIntervals[i];
+        ti.on.tm_hour = *p++;
+        ti.on.tm_min = *p++;
+        ti.on.tm_sec = *p++;
+        ti.onType = *p <= IRRADIANCE ? (TimeType)*p : EXACT;
+        p++;
+        ti.off.tm_hour = *p++;
+        ti.off.tm_min = *p++;
+        ti.off.tm_sec = *p++;
+        ti.offType = *p <= IRRADIANCE ? (TimeType)*p : EXACT;
+        p++;
+        ti.channels = p[0] | (p[1] << 8);
+        ti.weekdays = p[2];
+        ti.skipFrom = p[3] | (p[4] << 8);
+        ti.skipTo = p[5] | (p[6] << 8);
+        p += 7;
+    }
 }
 
 #endif
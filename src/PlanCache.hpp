@@ -0,0 +1,66 @@
+#ifndef PLANCACHE_HPP
+#define PLANCACHE_HPP
+
+/**
+ * Compiled daily plans of the last few days, keyed by day and configuration revision,
+ * so a plan is compiled once per day however often the loop asks for it, and going
+ * back across midnight (e.g. after an NTP correction) needs no recompilation.
+ * Schedule is LampSchedule or BitmapSchedule.
+ */
+template <typename Schedule, int Size = 2>
+class PlanCache
+{
+public:
+    PlanCache();
+
+    /**
+     * @param day days since 1970-01-01
+     * @return the plan compiled for the day with the given configuration revision,
+     * nullptr if there is none
+     */
+    Schedule *Find(long day, unsigned int revision);
+
+    /**
+     * Reserves the slot of the least recently inserted plan for the given day.
+     *
+     * @return the plan to be compiled by the caller
+     */
+    Schedule *Insert(long day, unsigned int revision);
+
+private:
+    Schedule _plans[Size];
+    long _days[Size];
+    unsigned int _revisions[Size];
+    int _next = 0; // Slot of the next insertion
+};
+
+template <typename Schedule, int Size>
+PlanCache<Schedule, Size>::PlanCache()
+{
+    for (int i = 0; i < Size; i++)
+        _days[i] = -1;
+}
+
+template <typename Schedule, int Size>
+Schedule *PlanCache<Schedule, Size>::Find(long day, unsigned int revision)
+{
+    for (int i = 0; i < Size; i++)
+    {
+        if (_days[i] == day && _revisions[i] == revision)
+            return &_plans[i];
+    }
+
+    return nullptr;
+}
+
+template <typename Schedule, int Size>
+Schedule *PlanCache<Schedule, Size>::Insert(long day, unsigned int revision)
+{
+    int i = _next;
+    _next = (_next + 1) % Size;
+    _days[i] = day;
+    _revisions[i] = revision;
+    return &_plans[i];
+}
+
+#endif
@@ -3,10 +3,14 @@
 
 #include <ESP8266WiFi.h>
 #include "EventLogger.hpp"
+#include "PersistentConfiguration.hpp"
+#include "Scheduler.hpp"
+#include "constants.h"
 
+// With BUILTIN_LED_ON_WITH_LAMP the builtin led follows the lamp of channel 1
 #ifdef BUILTIN_LED_ON_WITH_LAMP
-#define BUILTIN_LED_ON (_lampState + 1) % 2
-#define BUILTIN_LED_OFF _lampState
+#define BUILTIN_LED_ON (_lampStates & 1 ? HIGH : LOW)
+#define BUILTIN_LED_OFF (_lampStates & 1 ? LOW : HIGH)
 #else
 #define BUILTIN_LED_ON LOW
 #define BUILTIN_LED_OFF HIGH
@@ -15,49 +19,79 @@
 #define LAMP_ON LOW
 #define LAMP_OFF HIGH
 
-typedef uint8_t LampState;
-
-class PlatformManager
+/**
+ * Drives the lamp relays and the builtin led. As a task, it plays the led blink patterns
+ * without blocking.
+ */
+class PlatformManager : public Task
 {
 private:
-    LampState _lampState = LAMP_OFF;
-    uint8_t _builtinLed; // Its status will be the opposite of _lampState in order to be on when lamp is on
-    uint8_t _lampPin;
+    ChannelMask _lampStates = 0; // Bit set if the lamp of the channel is on
+    bool _lampsWritten = false;  // Pins are written all together the first time
+    uint8_t _builtinLed;
+    uint8_t _lampPins[NUM_CHANNELS];
+    unsigned int _blinkToggles = 0; // Led writes left in the current blink pattern
+    unsigned int _blinkDuration = 0;
     EventLogger *const _eventLogger;
 
+    void LogLamp(int channel, bool on);
+
 public:
-    PlatformManager(uint8_t builtinLed, uint8_t lampPin, EventLogger *eventLogger);
-    void LampOn();
-    void LampOff();
+    PlatformManager(uint8_t builtinLed, const uint8_t *lampPins, EventLogger *eventLogger);
+
+    /**
+     * Drives all the relays at once, only the channels whose state changed are written.
+     *
+     * @param states bit set if the lamp of the channel has to be on
+     */
+    void SetLampStates(ChannelMask states);
     void BlinkOn();
+
+    /**
+     * Starts a blink pattern, replacing the current one, and returns immediately.
+     */
     void Blink(int repeat = 1, int duration = 50);
-};
 
-PlatformManager::PlatformManager(uint8_t builtinLed, uint8_t lampPin, EventLogger *eventLogger)
-    : _builtinLed(builtinLed), _lampPin(lampPin), _eventLogger(eventLogger) {}
+    /**
+     * Advances the blink pattern.
+     */
+    unsigned long Run() override;
+};
 
-void PlatformManager::LampOn()
+PlatformManager::PlatformManager(uint8_t builtinLed, const uint8_t *lampPins, EventLogger *eventLogger)
+    : _builtinLed(builtinLed), _eventLogger(eventLogger)
 {
-    if (_lampState == LAMP_OFF)
-        _eventLogger->LogEvent(F("Lamp ON."));
+    for (int channel = 0; channel < NUM_CHANNELS; channel++)
+        _lampPins[channel] = lampPins[channel];
+}
 
-    _lampState = LAMP_ON;
-#ifdef BUILTIN_LED_ON_WITH_LAMP
-    digitalWrite(_builtinLed, (_lampState + 1) % 2);
+void PlatformManager::LogLamp(int channel, bool on)
+{
+#if NUM_CHANNELS > 1
+    _eventLogger->LogEvent(on ? EVENT_CHANNEL_ON : EVENT_CHANNEL_OFF, channel + 1);
+#else
+    _eventLogger->LogEvent(on ? EVENT_LAMP_ON : EVENT_LAMP_OFF);
 #endif
-    digitalWrite(_lampPin, _lampState);
 }
 
-void PlatformManager::LampOff()
+void PlatformManager::SetLampStates(ChannelMask states)
 {
-    if (_lampState == LAMP_ON)
-        _eventLogger->LogEvent(F("Lamp OFF."));
+    ChannelMask changed = _lampStates ^ states;
+    ChannelMask toWrite = _lampsWritten ? changed : (ChannelMask)((1UL << NUM_CHANNELS) - 1);
+    _lampStates = states;
+    _lampsWritten = true;
+
+    for (int channel = 0; toWrite; channel++, toWrite >>= 1, changed >>= 1)
+    {
+        if (changed & 1)
+            LogLamp(channel, states >> channel & 1);
+        if (toWrite & 1)
+            digitalWrite(_lampPins[channel], states >> channel & 1 ? LAMP_ON : LAMP_OFF);
+    }
 
-    _lampState = LAMP_OFF;
 #ifdef BUILTIN_LED_ON_WITH_LAMP
-    digitalWrite(_builtinLed, (_lampState + 1) % 2);
+    digitalWrite(_builtinLed, BUILTIN_LED_ON);
 #endif
-    digitalWrite(_lampPin, _lampState);
 }
 
 void PlatformManager::BlinkOn()
@@ -67,12 +101,19 @@ void PlatformManager::BlinkOn()
 
 void PlatformManager::Blink(int repeat, int duration)
 {
-    for (int i = 0; i < repeat; i++)
-    {
-        digitalWrite(_builtinLed, BUILTIN_LED_ON);
-        delay(duration);
-        digitalWrite(_builtinLed, BUILTIN_LED_OFF);
-        delay(duration);
-    }
+    _blinkToggles = 2 * repeat;
+    _blinkDuration = duration;
+    Wake();
+}
+
+unsigned long PlatformManager::Run()
+{
+    if (!_blinkToggles)
+        return IDLE;
+
+    // Odd toggles turn the led on, even ones turn it off
+    _blinkToggles--;
+    digitalWrite(_builtinLed, _blinkToggles % 2 ? BUILTIN_LED_ON : BUILTIN_LED_OFF);
+    return _blinkDuration;
 }
 #endif
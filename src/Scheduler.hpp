@@ -0,0 +1,120 @@
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+
+#include <Arduino.h>
+#include <limits.h>
+
+/**
+ * Unit of work of the cooperative runtime. Run() must never block: a task that has
+ * to wait returns how long, and keeps its progress in its own state.
+ */
+class Task
+{
+public:
+    // Returned by Run() to sleep until woken
+    static const unsigned long IDLE = ULONG_MAX;
+
+    virtual ~Task() {}
+
+    /**
+     * Runs a step of the task.
+     *
+     * @return milliseconds until the next step, IDLE to wait for Wake()
+     */
+    virtual unsigned long Run() = 0;
+
+    /**
+     * Makes the task due at the next scheduler pass. Safe to call from an ISR: always
+     * inlined, so it runs from the caller's IRAM.
+     */
+    inline __attribute__((always_inline)) void Wake() { _woken = true; }
+
+private:
+    friend class Scheduler;
+
+    volatile bool _woken = true; // Tasks run once when added
+    unsigned long _lastRun = 0;
+    unsigned long _delay = IDLE;
+};
+
+/**
+ * Task running a free function, for the tasks of the sketch.
+ */
+class FunctionTask : public Task
+{
+public:
+    FunctionTask(unsigned long (*function)()) : _function(function) {}
+    unsigned long Run() override { return _function(); }
+
+private:
+    unsigned long (*const _function)();
+};
+
+/**
+ * Cooperative runtime: runs the due tasks in order of addition, one step each per pass,
+ * and tells how long the loop can sleep.
+ */
+class Scheduler
+{
+public:
+    static const int MAX_TASKS = 8;
+
+    void Add(Task *task);
+
+    /**
+     * Runs a step of every due task.
+     */
+    void Run();
+
+    /**
+     * @return milliseconds until the first task is due, Task::IDLE if all are waiting for Wake()
+     */
+    unsigned long MillisToNextTask();
+
+private:
+    Task *_tasks[MAX_TASKS];
+    int _numTasks = 0;
+};
+
+void Scheduler::Add(Task *task)
+{
+    if (_numTasks < MAX_TASKS)
+        _tasks[_numTasks++] = task;
+}
+
+void Scheduler::Run()
+{
+    for (int i = 0; i < _numTasks; i++)
+    {
+        Task *task = _tasks[i];
+        if (!task->_woken && (task->_delay == Task::IDLE || millis() - task->_lastRun < task->_delay))
+            continue;
+
+        // Cleared before running, so a wake during the step is not lost
+        task->_woken = false;
+        task->_delay = task->Run();
+        task->_lastRun = millis();
+    }
+}
+
+unsigned long Scheduler::MillisToNextTask()
+{
+    unsigned long ms = Task::IDLE;
+    for (int i = 0; i < _numTasks; i++)
+    {
+        Task *task = _tasks[i];
+        if (task->_woken)
+            return 0;
+        if (task->_delay == Task::IDLE)
+            continue;
+
+        unsigned long elapsed = millis() - task->_lastRun;
+        unsigned long remaining = elapsed < task->_delay ? task->_delay - elapsed : 0;
+        if (remaining < ms)
+            ms = remaining;
+    }
+
+    return ms;
+}
+
+#endif
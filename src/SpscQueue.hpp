@@ -0,0 +1,57 @@
+#ifndef SPSCQUEUE_HPP
+#define SPSCQUEUE_HPP
+
+#include <atomic>
+
+/**
+ * Wait-free queue between one producer and one consumer, e.g. an ISR and the loop.
+ * Neither side blocks or allocates: the producer owns the tail, the consumer the head,
+ * and each publishes its index with release ordering after touching the slot.
+ * Size must be a power of two; the queue holds Size - 1 items.
+ */
+template <typename T, unsigned int Size = 8>
+class SpscQueue
+{
+    static_assert(Size >= 2 && (Size & (Size - 1)) == 0, "Size must be a power of two");
+
+public:
+    /**
+     * Producer side, safe in an ISR: always inlined, so it runs from the caller's IRAM.
+     *
+     * @return false if the queue is full and the item was dropped
+     */
+    inline __attribute__((always_inline)) bool Push(const T &item)
+    {
+        unsigned int tail = _tail.load(std::memory_order_relaxed);
+        unsigned int next = (tail + 1) & (Size - 1);
+        if (next == _head.load(std::memory_order_acquire))
+            return false;
+
+        _items[tail] = item;
+        _tail.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side.
+     *
+     * @return false if the queue is empty
+     */
+    bool Pop(T &item)
+    {
+        unsigned int head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire))
+            return false;
+
+        item = _items[head];
+        _head.store((head + 1) & (Size - 1), std::memory_order_release);
+        return true;
+    }
+
+private:
+    T _items[Size];
+    std::atomic<unsigned int> _head{0}; // Next item to pop
+    std::atomic<unsigned int> _tail{0}; // Next slot to push
+};
+
+#endif
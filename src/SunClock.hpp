@@ -2,17 +2,102 @@
 #define DAYLIGHT_SUNCLOCK_HPP
 
 #include <ctime>
-#include <Arduino.h>
+#include <cmath>
+#include "FastMath.hpp"
+#include "CivilTime.hpp"
+
+/**
+ * Sun events of a single day, as returned by Sunclock::sun_days
+ */
+struct SunDay
+{
+    time_t rise;
+    time_t noon;
+    time_t set;
+};
+
+/**
+ * Rise and set times of the sun at a given elevation.
+ * Both are (time_t)-1 if the sun never crosses that elevation on the day,
+ * except for SunEvents::sun.
+ */
+struct SunRiseSet
+{
+    time_t rise;
+    time_t set;
+};
+
+/**
+ * All the sun events of a single day, as returned by Sunclock::sun_events
+ */
+struct SunEvents
+{
+    time_t noon;
+    SunRiseSet sun;          // as sunrise()/sunset(), zenith 95°, polar day/night included
+    SunRiseSet civil;        // zenith 96°
+    SunRiseSet nautical;     // zenith 102°
+    SunRiseSet astronomical; // zenith 108°
+    SunRiseSet custom;       // caller-provided elevation
+};
 
-class Sunclock
+/**
+ * Streams irradiance at evenly spaced samples over a day, as returned by
+ * Sunclock::irradiance_curve. Irradiance is sin(lat)sin(dec) + cos(lat)cos(dec)cos(H):
+ * both products are interpolated linearly over the day and cos(H) is advanced by
+ * rotation, so a sample costs a few multiplications instead of the full chain.
+ */
+template <typename Real, typename Math>
+class BasicIrradianceCurve
 {
 public:
-    Sunclock(double const &latitude_, double const &longitude_, double const &tz_offset_ = 0);
+    BasicIrradianceCurve(Real base, Real base_step, Real amplitude, Real amplitude_step,
+                         Real hour_angle, Real hour_angle_step, int samples);
 
     /**
-   * \overload double Sunclock::irradiance(time_t when)
+   * @param irradiance set to the value of the next sample, like Sunclock::irradiance
+   * @return false when all the samples have been produced
    */
-    double irradiance();
+    bool next(Real &irradiance);
+
+    int remaining();
+
+private:
+    // Rotation is resynced with Math::cos/sin every RESYNC_INTERVAL samples to bound drift
+    static const int RESYNC_INTERVAL = 64;
+
+    Real _base, _base_step;
+    Real _amplitude, _amplitude_step;
+    Real _hour_angle, _hour_angle_step; // in radians
+    Real _cos_hour_angle, _sin_hour_angle;
+    Real _cos_step, _sin_step;
+    int _sample = 0;
+    int _samples;
+
+    void resync();
+};
+
+/**
+ * Solar calculator templated on the scalar type used for the solar math.
+ * Use Sunclock (double) as reference and SunclockF (float) on FPU-less targets,
+ * where float is emulated roughly twice as fast as double.
+ *
+ * Worst-case difference of SunclockF against Sunclock for sunrise, sunset and
+ * solar noon, years 2000-2100, latitudes -60°..60°: 1 second. Close to the polar
+ * circles sunrise and sunset are ill-conditioned and float reaches 14 s at 61°..65°.
+ *
+ * Math is the trigonometric backend, see FastMath.hpp. Building with
+ * SUNCLOCK_FAST_MATH=1 or 2 switches SunclockF to FastMath at that precision.
+ */
+template <typename Real, typename Math = StdMath<Real> >
+class BasicSunclock
+{
+public:
+    BasicSunclock(Real const &latitude_, Real const &longitude_, Real const &tz_offset_ = 0);
+
+    /**
+   * \overload Real BasicSunclock::irradiance(time_t when)
+   */
+    Real irradiance();
 
     /**
    * Specifically, we calculate Direct Normal Irradiance
@@ -22,15 +107,50 @@ public:
    * @param when
    * @return a value representing irradiance (power per unit area)
    */
-    double irradiance(time_t when);
+    Real irradiance(time_t when);
+
+    /**
+   * Returns a generator of irradiance at samples evenly spaced instants of the day
+   * of date, starting at midnight. Per-day terms are computed once at each end of
+   * the day, e.g. 1440 samples give a 1-minute resolution curve.
+   *
+   * @param date only date is considered
+   * @param samples number of samples in the day
+   */
+    BasicIrradianceCurve<Real, Math> irradiance_curve(time_t date, int samples);
 
     /**
-   * \overload time_t Sunclock::sunrise(time_t date)
+   * Finds the instant between from and to at which irradiance crosses threshold,
+   * with a bracketed root finder (Illinois variant of regula falsi).
+   * Seeding the bracket with sunrise/solar noon or solar noon/sunset gives the
+   * morning or evening crossing. Times are shifted by tz_offset like the ones
+   * returned by sunrise()/sunset(), while irradiance() takes UTC times.
+   *
+   * @return crossing time within one second, (time_t)-1 if irradiance is on the
+   * same side of threshold at both ends
+   */
+    time_t irradiance_crossing(time_t from, time_t to, Real threshold);
+
+    /**
+   * Finds the morning and evening crossings of threshold on the day of a sun_days() result.
+   * Where irradiance_crossing() finds none, irradiance at solar noon tells the side:
+   * always above (polar day, or a threshold below irradiance at sunrise and sunset) puts
+   * the rise one second before the day and the set at its end, always below (polar
+   * night, threshold not reached) puts both at solar noon.
+   *
+   * @param day as returned by sun_days()
+   * @return the crossings, shifted by tz_offset like day
+   */
+    SunRiseSet irradiance_crossings(SunDay const &day, Real threshold);
+
+    /**
+   * \overload time_t BasicSunclock::sunrise(time_t date)
    */
     time_t sunrise();
 
     /**
    * Returns sunrise time for given date
+   * During polar day it is 12 hours before solar noon, during polar night it is solar noon.
    *
    * @param date only date is considered
    * @return sunrise time
@@ -38,7 +158,7 @@ public:
     time_t sunrise(time_t date);
 
     /**
-   * \overload time_t Sunclock::solar_noon(time_t date)
+   * \overload time_t BasicSunclock::solar_noon(time_t date)
    */
     time_t solar_noon();
 
@@ -51,331 +171,574 @@ public:
     time_t solar_noon(time_t date);
 
     /**
-   * \overload time_t Sunclock::sunset(time_t date)
+   * \overload time_t BasicSunclock::sunset(time_t date)
    */
     time_t sunset();
 
     /**
    * Returns sunset time for given date
+   * During polar day it is 12 hours after solar noon, during polar night it is solar noon.
    *
    * @param date only date is considered
    * @return sunset time
    */
     time_t sunset(time_t date);
 
+    /**
+   * Computes sunrise, solar noon and sunset for a run of consecutive days.
+   * Terms shared by the three events are computed only once per day.
+   *
+   * @param date first date, only date is considered
+   * @param days caller-provided array holding at least count elements
+   * @param count number of days to compute
+   */
+    void sun_days(time_t date, SunDay *days, int count);
+
+    /**
+   * Computes solar noon, sunrise/sunset and civil, nautical and astronomical
+   * twilights for given date. Per-day terms are computed only once.
+   *
+   * @param date only date is considered
+   * @param events filled with the events of the day
+   * @param custom_elevation sun elevation in degrees for events.custom, negative below the horizon
+   */
+    void sun_events(time_t date, SunEvents &events, Real custom_elevation = 0);
+
 private:
+    /**
+   * Per-day terms shared by all the events of a day
+   */
+    struct DayTerms
+    {
+        Real eq_of_time;
+        Real declination;
+    };
+
     // in decimal degrees, east is positive
-    double const latitude;
+    Real const latitude;
 
     // in decimal degrees, north is positive
-    double const longitude;
+    Real const longitude;
 
     // in hours, east is positive, i.e. IST (+05:30) is 5.5
-    double const tz_offset;
+    Real const tz_offset;
+
+    static Real rad(Real degrees);
+    static Real deg(Real radians);
 
     /**
    * @param date
    * @return percentage past midnight, i.e. noon  is 0.5
    */
-    double time_of_day(time_t date);
-
-    static int days_since_1900(struct tm *t);
+    Real time_of_day(time_t date);
 
     /**
    * @param date
    * @param decimal_day decimal between 0.0 and 1.0, e.g. noon = 0.5
    * @return time_t with date and time set accordingly
    */
-    static time_t time_from_decimal_day(time_t date, double decimal_day);
+    static time_t time_from_decimal_day(time_t date, Real decimal_day);
 
     /**
-   * Get day count since Monday, January 1, 4713 BC
+   * Get day count since the J2000.0 epoch (julian day 2451545.0)
    * https://en.wikipedia.org/wiki/Julian_day
    *
-   * @param t
+   * The integer part is computed before converting to Real, so that single
+   * precision does not lose the time of day against the 2.4M julian day.
+   *
+   * @param days        days since 1970-01-01
    * @param time_of_day percentage past midnight, i.e. noon is 0.5
    * @param tz_offset   in hours, east is positive, i.e. IST (+05:30) is 5.5
-   * @return julian day
+   * @return days since J2000.0
    */
-    static double julian_day(struct tm *t, double const &time_of_day, double const &tz_offset);
+    static Real j2000_day(long days, Real const &time_of_day, Real const &tz_offset);
 
     /**
    * Extract information in a suitable format from a time_t object.
    */
     void prepare_time(time_t const &when, struct tm *ptm);
 
-    double julian_century(double _julian_day);
-    double mean_long_sun(double _julian_century);
-    double mean_anom_sun(double _julian_century);
-    double sun_eq_of_centre(double _mean_anom_sun, double _julian_century);
-    double eccent_earth_orbit(double _julian_century);
-    double var_y(double _obliq_corr);
-    double mean_obliq_ecliptic(double _julian_century);
-    double sun_true_long(double _mean_long_sun, double _sun_eq_of_centre);
-    double obliq_corr(double _mean_obliq_ecliptic, double _julian_century);
-    double sun_app_long(double _sun_true_long, double _julian_century);
-    double declination(double _obliq_corr, double _sun_app_long);
-    double eq_of_time(double _var_y, double _mean_long_sun, double _eccent_earth_orbit,
-                      double _mean_anom_sun);
-    double true_solar_time(double _time_of_day, double _eq_of_time);
-    double hour_angle(double _true_solar_time);
-    double hour_angle_sunrise(double _declination);
-    double solar_zenith(double _declination, double _hour_angle);
-    double solar_elevation(double _solar_zenith);
+    /**
+   * @param date already shifted by tz_offset
+   * @return days since J2000.0 of date, time of day included
+   */
+    Real j2000_day(time_t date);
+
+    /**
+   * Runs the chain from julian century down to equation of time and declination.
+   */
+    void day_terms(Real _j2000_day, DayTerms &terms);
+
+    /**
+   * @return solar noon as percentage past midnight
+   */
+    Real noon_decimal_day(Real _eq_of_time);
+
+    /**
+   * Fills rise and set for the given zenith, given the per-day products
+   * cos(latitude) * cos(declination) and tan(latitude) * tan(declination).
+   * If the sun never crosses the zenith, both are -1, or with clamp the same
+   * as hour_angle_zenith gives: 12 hours around solar noon, or solar noon.
+   */
+    static void rise_set(time_t date, Real _noon_decimal_day, Real _zenith,
+                         Real _cos_product, Real _tan_product, SunRiseSet &events, bool clamp = false);
+
+    Real julian_century(Real _j2000_day);
+    Real mean_long_sun(Real _julian_century);
+    Real mean_anom_sun(Real _julian_century);
+    Real sun_eq_of_centre(Real _mean_anom_sun, Real _julian_century);
+    Real eccent_earth_orbit(Real _julian_century);
+    Real var_y(Real _obliq_corr);
+    Real mean_obliq_ecliptic(Real _julian_century);
+    Real sun_true_long(Real _mean_long_sun, Real _sun_eq_of_centre);
+    Real obliq_corr(Real _mean_obliq_ecliptic, Real _julian_century);
+    Real sun_app_long(Real _sun_true_long, Real _julian_century);
+    Real declination(Real _obliq_corr, Real _sun_app_long);
+    Real eq_of_time(Real _var_y, Real _mean_long_sun, Real _eccent_earth_orbit,
+                    Real _mean_anom_sun);
+    Real true_solar_time(Real _time_of_day, Real _eq_of_time);
+    Real hour_angle(Real _true_solar_time);
+    Real hour_angle_sunrise(Real _declination);
+    Real hour_angle_zenith(Real _declination, Real _zenith);
+    Real solar_zenith(Real _declination, Real _hour_angle);
+    Real solar_elevation(Real _solar_zenith);
 };
 
+typedef BasicSunclock<double> Sunclock;
+#ifdef SUNCLOCK_FAST_MATH
+typedef BasicSunclock<float, FastMath<float, SUNCLOCK_FAST_MATH> > SunclockF;
+#else
+typedef BasicSunclock<float> SunclockF;
+#endif
+
 /// Implementation
 
-inline double rad(double degrees)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::rad(Real degrees)
 {
-    static const double degToRad = 4.0 * atan(1.0) / 180.0;
-    return degrees * degToRad;
+    return degrees * Real(0.017453292519943295);
 }
 
-inline double deg(double radians)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::deg(Real radians)
 {
-    static const double radToDeg = 180.0 / (4.0 * atan(1.0));
-    return radians * radToDeg;
+    return radians * Real(57.29577951308232);
 }
 
-Sunclock::Sunclock(double const &latitude_, double const &longitude_, double const &tz_offset_)
+template <typename Real, typename Math>
+BasicSunclock<Real, Math>::BasicSunclock(Real const &latitude_, Real const &longitude_, Real const &tz_offset_)
     : latitude(latitude_), longitude(longitude_), tz_offset(tz_offset_) {}
 
-double Sunclock::irradiance() { return irradiance(time(0)); }
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::irradiance() { return irradiance(time(0)); }
 
-double Sunclock::irradiance(time_t when)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::irradiance(time_t when)
 {
     when = when + (time_t)(tz_offset * 60 * 60);
-    struct tm *t = gmtime(&when);
-    double _time_of_day = time_of_day(when);
-    double _julian_day = julian_day(t, _time_of_day, tz_offset);
-    double _julian_century = julian_century(_julian_day);
-    double _mean_obliq_ecliptic = mean_obliq_ecliptic(_julian_century);
-    double _mean_long_sun = mean_long_sun(_julian_century);
-    double _mean_anom_sun = mean_anom_sun(_julian_century);
-    double _sun_eq_of_centre = sun_eq_of_centre(_mean_anom_sun, _julian_century);
-    double _sun_true_long = sun_true_long(_mean_long_sun, _sun_eq_of_centre);
-    double _obliq_corr = obliq_corr(_mean_obliq_ecliptic, _julian_century);
-    double _sun_app_long = sun_app_long(_sun_true_long, _julian_century);
-    double _eccent_earth_orbit = eccent_earth_orbit(_julian_century);
-    double _var_y = var_y(_obliq_corr);
-    double _eq_of_time = eq_of_time(_var_y, _mean_long_sun, _eccent_earth_orbit, _mean_anom_sun);
-    double _declination = declination(_obliq_corr, _sun_app_long);
-    double _true_solar_time = true_solar_time(_time_of_day, _eq_of_time);
-    double _hour_angle = hour_angle(_true_solar_time);
-    double _solar_zenith = solar_zenith(_declination, _hour_angle);
-    return std::cos(rad(_solar_zenith));
-}
-
-time_t Sunclock::sunrise() { return sunrise(time(0)); }
-
-time_t Sunclock::sunrise(time_t date)
+    Real _time_of_day = time_of_day(when);
+    DayTerms terms;
+    day_terms(j2000_day(when), terms);
+    Real _true_solar_time = true_solar_time(_time_of_day, terms.eq_of_time);
+    Real _hour_angle = hour_angle(_true_solar_time);
+    Real _solar_zenith = solar_zenith(terms.declination, _hour_angle);
+    return Math::cos(rad(_solar_zenith));
+}
+
+template <typename Real, typename Math>
+BasicIrradianceCurve<Real, Math> BasicSunclock<Real, Math>::irradiance_curve(time_t date, int samples)
 {
     date = date + (time_t)(tz_offset * 60 * 60);
-    struct tm *t = gmtime(&date);
-    double _time_of_day = time_of_day(date);
-    double _julian_day = julian_day(t, _time_of_day, tz_offset);
-    double _julian_century = julian_century(_julian_day);
-    double _mean_obliq_ecliptic = mean_obliq_ecliptic(_julian_century);
-    double _mean_long_sun = mean_long_sun(_julian_century);
-    double _mean_anom_sun = mean_anom_sun(_julian_century);
-    double _sun_eq_of_centre = sun_eq_of_centre(_mean_anom_sun, _julian_century);
-    double _sun_true_long = sun_true_long(_mean_long_sun, _sun_eq_of_centre);
-    double _obliq_corr = obliq_corr(_mean_obliq_ecliptic, _julian_century);
-    double _sun_app_long = sun_app_long(_sun_true_long, _julian_century);
-    double _eccent_earth_orbit = eccent_earth_orbit(_julian_century);
-    double _var_y = var_y(_obliq_corr);
-    double _eq_of_time = eq_of_time(_var_y, _mean_long_sun, _eccent_earth_orbit, _mean_anom_sun);
-    double _declination = declination(_obliq_corr, _sun_app_long);
-    double _hour_angle_sunrise = hour_angle_sunrise(_declination);
-
-    double noon_decimal_day = (720 - 4 * longitude - _eq_of_time + tz_offset * 60) / 1440;
-    double decimal_day = noon_decimal_day - _hour_angle_sunrise * 4 / 1440;
-    return time_from_decimal_day(date, decimal_day);
+    date -= seconds_of_day(date);
+    Real _j2000_day = j2000_day(date);
+    DayTerms start, end;
+    day_terms(_j2000_day, start);
+    day_terms(_j2000_day + 1, end);
+
+    Real sin_latitude = Math::sin(rad(latitude)), cos_latitude = Math::cos(rad(latitude));
+    Real base = sin_latitude * Math::sin(rad(start.declination));
+    Real amplitude = cos_latitude * Math::cos(rad(start.declination));
+    Real base_end = sin_latitude * Math::sin(rad(end.declination));
+    Real amplitude_end = cos_latitude * Math::cos(rad(end.declination));
+
+    // A full turn of hour angle per day, corrected by the drift of the equation of time
+    Real _hour_angle = hour_angle(true_solar_time(0, start.eq_of_time));
+    Real _hour_angle_step = (360 + (end.eq_of_time - start.eq_of_time) / 4) / samples;
+
+    return BasicIrradianceCurve<Real, Math>(base, (base_end - base) / samples,
+                                            amplitude, (amplitude_end - amplitude) / samples,
+                                            rad(_hour_angle), rad(_hour_angle_step), samples);
 }
 
-time_t Sunclock::solar_noon() { return solar_noon(time(0)); }
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::irradiance_crossing(time_t from, time_t to, Real threshold)
+{
+    time_t utc_offset = (time_t)(tz_offset * 60 * 60);
+    Real f_from = irradiance(from - utc_offset) - threshold;
+    Real f_to = irradiance(to - utc_offset) - threshold;
+    if ((f_from > 0) == (f_to > 0))
+        return (time_t)-1;
+
+    // Bracket always holds the crossing, the stale end is halved to keep convergence superlinear
+    int side = 0;
+    while (to - from > 1)
+    {
+        time_t mid = from + (time_t)((to - from) * (f_from / (f_from - f_to)));
+        if (mid <= from)
+            mid = from + 1;
+        if (mid >= to)
+            mid = to - 1;
+
+        Real f_mid = irradiance(mid - utc_offset) - threshold;
+        if ((f_mid > 0) == (f_to > 0))
+        {
+            to = mid;
+            f_to = f_mid;
+            if (side == -1)
+                f_from /= 2;
+            side = -1;
+        }
+        else
+        {
+            from = mid;
+            f_from = f_mid;
+            if (side == 1)
+                f_to /= 2;
+            side = 1;
+        }
+    }
+
+    return to;
+}
 
-time_t Sunclock::solar_noon(time_t date)
+template <typename Real, typename Math>
+SunRiseSet BasicSunclock<Real, Math>::irradiance_crossings(SunDay const &day, Real threshold)
 {
-    date = date + (time_t)(tz_offset * 60 * 60);
-    struct tm *t = gmtime(&date);
-    double _time_of_day = time_of_day(date);
-    double _julian_day = julian_day(t, _time_of_day, tz_offset);
-    double _julian_century = julian_century(_julian_day);
-    double _mean_obliq_ecliptic = mean_obliq_ecliptic(_julian_century);
-    double _mean_long_sun = mean_long_sun(_julian_century);
-    double _mean_anom_sun = mean_anom_sun(_julian_century);
-    double _obliq_corr = obliq_corr(_mean_obliq_ecliptic, _julian_century);
-    double _eccent_earth_orbit = eccent_earth_orbit(_julian_century);
-    double _var_y = var_y(_obliq_corr);
-    double _eq_of_time = eq_of_time(_var_y, _mean_long_sun, _eccent_earth_orbit, _mean_anom_sun);
-
-    double decimal_day = (720 - 4 * longitude - _eq_of_time + tz_offset * 60) / 1440;
-    return time_from_decimal_day(date, decimal_day);
+    SunRiseSet crossings;
+    crossings.rise = irradiance_crossing(day.rise, day.noon, threshold);
+    crossings.set = irradiance_crossing(day.noon, day.set, threshold);
+    if (crossings.rise != (time_t)-1 && crossings.set != (time_t)-1)
+        return crossings;
+
+    bool above = irradiance(day.noon - (time_t)(tz_offset * 60 * 60)) > threshold;
+    time_t start = (time_t)days_from_time(day.noon) * SECONDS_PER_DAY;
+    if (crossings.rise == (time_t)-1)
+        crossings.rise = above ? start - 1 : day.noon;
+    if (crossings.set == (time_t)-1)
+        crossings.set = above ? start + SECONDS_PER_DAY : day.noon;
+    return crossings;
+}
+
+template <typename Real, typename Math>
+BasicIrradianceCurve<Real, Math>::BasicIrradianceCurve(Real base, Real base_step, Real amplitude, Real amplitude_step,
+                                                       Real hour_angle, Real hour_angle_step, int samples)
+    : _base(base), _base_step(base_step), _amplitude(amplitude), _amplitude_step(amplitude_step),
+      _hour_angle(hour_angle), _hour_angle_step(hour_angle_step),
+      _cos_step(Math::cos(hour_angle_step)), _sin_step(Math::sin(hour_angle_step)), _samples(samples)
+{
+    resync();
+}
+
+template <typename Real, typename Math>
+bool BasicIrradianceCurve<Real, Math>::next(Real &irradiance)
+{
+    if (_sample >= _samples)
+        return false;
+
+    if (_sample % RESYNC_INTERVAL == 0)
+        resync();
+
+    irradiance = _base + _sample * _base_step + (_amplitude + _sample * _amplitude_step) * _cos_hour_angle;
+    if (irradiance > 1)
+        irradiance = 1;
+    if (irradiance < -1)
+        irradiance = -1;
+
+    // cos(H + step), sin(H + step)
+    Real cos_hour_angle = _cos_hour_angle * _cos_step - _sin_hour_angle * _sin_step;
+    _sin_hour_angle = _sin_hour_angle * _cos_step + _cos_hour_angle * _sin_step;
+    _cos_hour_angle = cos_hour_angle;
+    _sample++;
+    return true;
+}
+
+template <typename Real, typename Math>
+int BasicIrradianceCurve<Real, Math>::remaining() { return _samples - _sample; }
+
+template <typename Real, typename Math>
+void BasicIrradianceCurve<Real, Math>::resync()
+{
+    Real angle = _hour_angle + _sample * _hour_angle_step;
+    _cos_hour_angle = Math::cos(angle);
+    _sin_hour_angle = Math::sin(angle);
 }
 
-time_t Sunclock::sunset() { return sunset(time(0)); }
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::sunrise() { return sunrise(time(0)); }
 
-time_t Sunclock::sunset(time_t date)
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::sunrise(time_t date)
 {
     date = date + (time_t)(tz_offset * 60 * 60);
-    struct tm *t = gmtime(&date);
-    double _time_of_day = time_of_day(date);
-    double _julian_day = julian_day(t, _time_of_day, tz_offset);
-    double _julian_century = julian_century(_julian_day);
-    double _mean_obliq_ecliptic = mean_obliq_ecliptic(_julian_century);
-    double _mean_long_sun = mean_long_sun(_julian_century);
-    double _mean_anom_sun = mean_anom_sun(_julian_century);
-    double _sun_eq_of_centre = sun_eq_of_centre(_mean_anom_sun, _julian_century);
-    double _sun_true_long = sun_true_long(_mean_long_sun, _sun_eq_of_centre);
-    double _obliq_corr = obliq_corr(_mean_obliq_ecliptic, _julian_century);
-    double _sun_app_long = sun_app_long(_sun_true_long, _julian_century);
-    double _eccent_earth_orbit = eccent_earth_orbit(_julian_century);
-    double _var_y = var_y(_obliq_corr);
-    double _eq_of_time = eq_of_time(_var_y, _mean_long_sun, _eccent_earth_orbit, _mean_anom_sun);
-    double _declination = declination(_obliq_corr, _sun_app_long);
-    double _hour_angle_sunrise = hour_angle_sunrise(_declination);
-
-    double noon_decimal_day = (720 - 4 * longitude - _eq_of_time + tz_offset * 60) / 1440;
-    double decimal_day = noon_decimal_day + _hour_angle_sunrise * 4 / 1440;
+    DayTerms terms;
+    day_terms(j2000_day(date), terms);
+    Real _hour_angle_sunrise = hour_angle_sunrise(terms.declination);
+
+    Real decimal_day = noon_decimal_day(terms.eq_of_time) - _hour_angle_sunrise * 4 / 1440;
     return time_from_decimal_day(date, decimal_day);
 }
 
-double Sunclock::time_of_day(time_t date)
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::solar_noon() { return solar_noon(time(0)); }
+
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::solar_noon(time_t date)
 {
-    struct tm *t = gmtime(&date);
-    return (t->tm_hour + t->tm_min / 60.0 + t->tm_sec / 3600.0) / 24.0;
+    date = date + (time_t)(tz_offset * 60 * 60);
+    DayTerms terms;
+    day_terms(j2000_day(date), terms);
+
+    return time_from_decimal_day(date, noon_decimal_day(terms.eq_of_time));
 }
 
-time_t Sunclock::time_from_decimal_day(time_t date, double decimal_day)
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::sunset() { return sunset(time(0)); }
+
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::sunset(time_t date)
 {
-    struct std::tm epoch;
-    epoch.tm_isdst = 0;
-    epoch.tm_sec = epoch.tm_min = epoch.tm_hour = epoch.tm_mon = 0;
-    epoch.tm_mday = 1;
-    epoch.tm_year = 70;
-    time_t local_tz_offset = mktime(&epoch);
+    date = date + (time_t)(tz_offset * 60 * 60);
+    DayTerms terms;
+    day_terms(j2000_day(date), terms);
+    Real _hour_angle_sunrise = hour_angle_sunrise(terms.declination);
 
-    struct tm *dt = gmtime(&date);
-    struct tm t = {};
-    t.tm_year = dt->tm_year;
-    t.tm_mon = dt->tm_mon;
-    t.tm_mday = dt->tm_mday;
-    double hours = 24.0 * decimal_day;
-    t.tm_hour = int(hours);
-    double minutes = (hours - t.tm_hour) * 60;
-    t.tm_min = int(minutes);
-    double seconds = (minutes - t.tm_sec) * 60;
-    t.tm_sec = int(seconds) % 60;
-    return mktime(&t) - local_tz_offset;
+    Real decimal_day = noon_decimal_day(terms.eq_of_time) + _hour_angle_sunrise * 4 / 1440;
+    return time_from_decimal_day(date, decimal_day);
+}
+
+template <typename Real, typename Math>
+void BasicSunclock<Real, Math>::sun_days(time_t date, SunDay *days, int count)
+{
+    date = date + (time_t)(tz_offset * 60 * 60);
+    // Consecutive days are exactly one julian day apart, so the calendar is decoded only once
+    Real _j2000_day = j2000_day(date);
+    for (int i = 0; i < count; i++, date += 24 * 60 * 60)
+    {
+        DayTerms terms;
+        day_terms(_j2000_day + i, terms);
+        Real _noon_decimal_day = noon_decimal_day(terms.eq_of_time);
+        Real _hour_angle_sunrise = hour_angle_sunrise(terms.declination);
+
+        days[i].rise = time_from_decimal_day(date, _noon_decimal_day - _hour_angle_sunrise * 4 / 1440);
+        days[i].noon = time_from_decimal_day(date, _noon_decimal_day);
+        days[i].set = time_from_decimal_day(date, _noon_decimal_day + _hour_angle_sunrise * 4 / 1440);
+    }
 }
 
-int Sunclock::days_since_1900(struct tm *t)
+template <typename Real, typename Math>
+void BasicSunclock<Real, Math>::sun_events(time_t date, SunEvents &events, Real custom_elevation)
 {
-    int year = t->tm_year;
-    if (year < 0 || year > 199)
-        year = 0;
-    if (year > 199)
-        year = 199;
-        
-    int month = t->tm_mon + 1;
-    int days = t->tm_mday;
+    date = date + (time_t)(tz_offset * 60 * 60);
+    DayTerms terms;
+    day_terms(j2000_day(date), terms);
+    Real _noon_decimal_day = noon_decimal_day(terms.eq_of_time);
+    Real _cos_product = Math::cos(rad(latitude)) * Math::cos(rad(terms.declination));
+    Real _tan_product = Math::tan(rad(latitude)) * Math::tan(rad(terms.declination));
+
+    events.noon = time_from_decimal_day(date, _noon_decimal_day);
+    rise_set(date, _noon_decimal_day, 95, _cos_product, _tan_product, events.sun, true);
+    rise_set(date, _noon_decimal_day, 96, _cos_product, _tan_product, events.civil);
+    rise_set(date, _noon_decimal_day, 102, _cos_product, _tan_product, events.nautical);
+    rise_set(date, _noon_decimal_day, 108, _cos_product, _tan_product, events.astronomical);
+    rise_set(date, _noon_decimal_day, 90 - custom_elevation, _cos_product, _tan_product, events.custom);
+}
 
-    if (month < 3)
+template <typename Real, typename Math>
+void BasicSunclock<Real, Math>::rise_set(time_t date, Real _noon_decimal_day, Real _zenith,
+                                   Real _cos_product, Real _tan_product, SunRiseSet &events, bool clamp)
+{
+    Real cos_hour_angle = Math::cos(rad(_zenith)) / _cos_product - _tan_product;
+    Real _hour_angle;
+    if (cos_hour_angle < -1 || cos_hour_angle > 1)
     {
-        month += 12;
-        year--;
+        // Sun always above or always below the given elevation
+        if (!clamp)
+        {
+            events.rise = events.set = (time_t)-1;
+            return;
+        }
+        _hour_angle = cos_hour_angle < -1 ? 180 : 0;
     }
-    int yearDays = (int)(year * 365.25);
-    int monthDays = (int)((month + 1) * 30.61);
+    else
+        _hour_angle = deg(Math::acos(cos_hour_angle));
+
+    events.rise = time_from_decimal_day(date, _noon_decimal_day - _hour_angle * 4 / 1440);
+    events.set = time_from_decimal_day(date, _noon_decimal_day + _hour_angle * 4 / 1440);
+}
+
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::j2000_day(time_t date)
+{
+    return j2000_day(days_from_time(date), time_of_day(date), tz_offset);
+}
+
+template <typename Real, typename Math>
+void BasicSunclock<Real, Math>::day_terms(Real _j2000_day, DayTerms &terms)
+{
+    Real _julian_century = julian_century(_j2000_day);
+    Real _mean_obliq_ecliptic = mean_obliq_ecliptic(_julian_century);
+    Real _mean_long_sun = mean_long_sun(_julian_century);
+    Real _mean_anom_sun = mean_anom_sun(_julian_century);
+    Real _sun_eq_of_centre = sun_eq_of_centre(_mean_anom_sun, _julian_century);
+    Real _sun_true_long = sun_true_long(_mean_long_sun, _sun_eq_of_centre);
+    Real _obliq_corr = obliq_corr(_mean_obliq_ecliptic, _julian_century);
+    Real _sun_app_long = sun_app_long(_sun_true_long, _julian_century);
+    Real _eccent_earth_orbit = eccent_earth_orbit(_julian_century);
+    Real _var_y = var_y(_obliq_corr);
+    terms.eq_of_time = eq_of_time(_var_y, _mean_long_sun, _eccent_earth_orbit, _mean_anom_sun);
+    terms.declination = declination(_obliq_corr, _sun_app_long);
+}
+
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::noon_decimal_day(Real _eq_of_time)
+{
+    return (720 - 4 * longitude - _eq_of_time + tz_offset * 60) / 1440;
+}
 
-    return (yearDays + monthDays + days - 63);
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::time_of_day(time_t date)
+{
+    long seconds = seconds_of_day(date);
+    return (seconds / 3600 + seconds / 60 % 60 / Real(60) + seconds % 60 / Real(3600)) / 24;
+}
+
+template <typename Real, typename Math>
+time_t BasicSunclock<Real, Math>::time_from_decimal_day(time_t date, Real decimal_day)
+{
+    Real hours = 24 * decimal_day;
+    int hour = int(hours);
+    Real minutes = (hours - hour) * 60;
+    int min = int(minutes);
+    int sec = int(minutes * 60) % 60;
+    return (time_t)days_from_time(date) * SECONDS_PER_DAY + hour * 3600L + min * 60L + sec;
 }
 
-double Sunclock::julian_day(struct tm *t, double const &time_of_day, double const &tz_offset)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::j2000_day(long days, Real const &time_of_day, Real const &tz_offset)
 {
-    return days_since_1900(t) + 2415018.5 + time_of_day - tz_offset / 24;
+    // julian day = days + 2440586.5 + time_of_day - tz_offset / 24, as computed by the former
+    // days_since_1900 based formula (one day behind the astronomical julian day)
+    return (days - 10958) + (time_of_day - Real(0.5) - tz_offset / 24);
 }
 
-double Sunclock::julian_century(double _julian_day) { return (_julian_day - 2451545.0) / 36525.0; }
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::julian_century(Real _j2000_day) { return _j2000_day / 36525; }
 
-double Sunclock::mean_long_sun(double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::mean_long_sun(Real _julian_century)
 {
-    return (280.46646 + fmod(_julian_century * (36000.76983 + _julian_century * 0.0003032), 360));
+    return (Real(280.46646) + std::fmod(_julian_century * (Real(36000.76983) + _julian_century * Real(0.0003032)), Real(360)));
 }
 
-double Sunclock::mean_anom_sun(double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::mean_anom_sun(Real _julian_century)
 {
-    return 357.52911 + _julian_century * (35999.05029 - 0.0001537 * _julian_century);
+    return Real(357.52911) + _julian_century * (Real(35999.05029) - Real(0.0001537) * _julian_century);
 }
 
-double Sunclock::sun_eq_of_centre(double _mean_anom_sun, double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::sun_eq_of_centre(Real _mean_anom_sun, Real _julian_century)
 {
-    return sin(rad(_mean_anom_sun)) * (1.914602 - _julian_century * (0.004817 + 0.000014 * _julian_century)) + sin(rad(2 * _mean_anom_sun)) * (0.019993 - 0.000101 * _julian_century) + sin(rad(3 * _mean_anom_sun)) * 0.000289;
+    return Math::sin(rad(_mean_anom_sun)) * (Real(1.914602) - _julian_century * (Real(0.004817) + Real(0.000014) * _julian_century)) + Math::sin(rad(2 * _mean_anom_sun)) * (Real(0.019993) - Real(0.000101) * _julian_century) + Math::sin(rad(3 * _mean_anom_sun)) * Real(0.000289);
 }
 
-double Sunclock::sun_true_long(double _mean_long_sun, double _sun_eq_of_centre)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::sun_true_long(Real _mean_long_sun, Real _sun_eq_of_centre)
 {
     return _mean_long_sun + _sun_eq_of_centre;
 }
 
-double Sunclock::eccent_earth_orbit(double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::eccent_earth_orbit(Real _julian_century)
 {
-    return 0.016708634 - _julian_century * (0.000042037 + 0.0001537 * _julian_century);
+    return Real(0.016708634) - _julian_century * (Real(0.000042037) + Real(0.0001537) * _julian_century);
 }
 
-double Sunclock::var_y(double _obliq_corr)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::var_y(Real _obliq_corr)
 {
-    return tan(rad(_obliq_corr / 2)) * tan(rad(_obliq_corr / 2));
+    return Math::tan(rad(_obliq_corr / 2)) * Math::tan(rad(_obliq_corr / 2));
 }
 
-double Sunclock::mean_obliq_ecliptic(double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::mean_obliq_ecliptic(Real _julian_century)
 {
-    return (23 + (26 + ((21.448 - _julian_century * (46.815 + _julian_century * (0.00059 - _julian_century * 0.001813)))) / 60) / 60);
+    return (23 + (26 + ((Real(21.448) - _julian_century * (Real(46.815) + _julian_century * (Real(0.00059) - _julian_century * Real(0.001813))))) / 60) / 60);
 }
 
-double Sunclock::obliq_corr(double _mean_obliq_ecliptic, double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::obliq_corr(Real _mean_obliq_ecliptic, Real _julian_century)
 {
-    return _mean_obliq_ecliptic + 0.00256 * cos(deg(125.04 - 1934.136 * _julian_century));
+    return _mean_obliq_ecliptic + Real(0.00256) * Math::cos(deg(Real(125.04) - Real(1934.136) * _julian_century));
 }
 
-double Sunclock::sun_app_long(double _sun_true_long, double _julian_century)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::sun_app_long(Real _sun_true_long, Real _julian_century)
 {
-    return (_sun_true_long - 0.00569 - 0.00478 * sin(deg(125.04 - 1934.136 * _julian_century)));
+    return (_sun_true_long - Real(0.00569) - Real(0.00478) * Math::sin(deg(Real(125.04) - Real(1934.136) * _julian_century)));
 }
 
-double Sunclock::declination(double _obliq_corr, double _sun_app_long)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::declination(Real _obliq_corr, Real _sun_app_long)
 {
-    return deg(asin(sin(rad(_obliq_corr)) * sin(rad(_sun_app_long))));
+    return deg(Math::asin(Math::sin(rad(_obliq_corr)) * Math::sin(rad(_sun_app_long))));
 }
 
-double Sunclock::eq_of_time(double _var_y, double _mean_long_sun, double _eccent_earth_orbit,
-                            double _mean_anom_sun)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::eq_of_time(Real _var_y, Real _mean_long_sun, Real _eccent_earth_orbit,
+                                     Real _mean_anom_sun)
 {
-    return 4 * deg(_var_y * sin(2 * rad(_mean_long_sun)) - 2 * _eccent_earth_orbit * sin(rad(_mean_anom_sun)) + 4 * _eccent_earth_orbit * _var_y * sin(rad(_mean_anom_sun)) * cos(2 * rad(_mean_long_sun)) - 0.5 * _var_y * _var_y * sin(4 * rad(_mean_long_sun)) - 1.25 * _eccent_earth_orbit * _eccent_earth_orbit * sin(2 * rad(_mean_anom_sun)));
+    return 4 * deg(_var_y * Math::sin(2 * rad(_mean_long_sun)) - 2 * _eccent_earth_orbit * Math::sin(rad(_mean_anom_sun)) + 4 * _eccent_earth_orbit * _var_y * Math::sin(rad(_mean_anom_sun)) * Math::cos(2 * rad(_mean_long_sun)) - Real(0.5) * _var_y * _var_y * Math::sin(4 * rad(_mean_long_sun)) - Real(1.25) * _eccent_earth_orbit * _eccent_earth_orbit * Math::sin(2 * rad(_mean_anom_sun)));
 }
 
-double Sunclock::true_solar_time(double _time_of_day, double _eq_of_time)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::true_solar_time(Real _time_of_day, Real _eq_of_time)
 {
-    return fmod((_time_of_day * 1440 + _eq_of_time + 4 * longitude - 60 * tz_offset), 1440);
+    return std::fmod((_time_of_day * 1440 + _eq_of_time + 4 * longitude - 60 * tz_offset), Real(1440));
 }
 
-double Sunclock::hour_angle(double _true_solar_time)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::hour_angle(Real _true_solar_time)
 {
     return (_true_solar_time / 4 < 0 ? _true_solar_time / 4 + 180 : _true_solar_time / 4 - 180);
 }
 
-double Sunclock::hour_angle_sunrise(double _declination)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::hour_angle_sunrise(Real _declination)
+{
+    return hour_angle_zenith(_declination, 95);
+}
+
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::hour_angle_zenith(Real _declination, Real _zenith)
 {
-    return deg(acos(cos(rad(95)) / (cos(rad(latitude)) * cos(rad(_declination))) - tan(rad(latitude)) * tan(rad(_declination))));
+    Real cos_hour_angle = Math::cos(rad(_zenith)) / (Math::cos(rad(latitude)) * Math::cos(rad(_declination))) - Math::tan(rad(latitude)) * Math::tan(rad(_declination));
+
+    // Out of domain at polar day (< -1) and polar night (> 1)
+    if (cos_hour_angle < -1)
+        return 180;
+    if (cos_hour_angle > 1)
+        return 0;
+    return deg(Math::acos(cos_hour_angle));
 }
 
-double Sunclock::solar_zenith(double _declination, double _hour_angle)
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::solar_zenith(Real _declination, Real _hour_angle)
 {
-    return deg(acos(sin(rad(latitude)) * sin(rad(_declination)) + cos(rad(latitude)) * cos(rad(_declination)) * cos(rad(_hour_angle))));
+    return deg(Math::acos(Math::sin(rad(latitude)) * Math::sin(rad(_declination)) + Math::cos(rad(latitude)) * Math::cos(rad(_declination)) * Math::cos(rad(_hour_angle))));
 }
 
-double Sunclock::solar_elevation(double _solar_zenith) { return 90 - _solar_zenith; }
+template <typename Real, typename Math>
+Real BasicSunclock<Real, Math>::solar_elevation(Real _solar_zenith) { return 90 - _solar_zenith; }
 
-#endif
\ No newline at end of file
+#endif
@@ -4,24 +4,62 @@
 #include <ESP8266WiFi.h>
 #include <DNSServer.h>
 #include <WiFiClient.h>
-#include <EEPROM.h>
 #include <ESP8266WebServer.h>
 #include <string>
 #include "PlatformManager.hpp"
 #include "PersistentConfiguration.hpp"
 #include "NTPClient.hpp"
 #include "EventLogger.hpp"
+#include "Crc.hpp"
 #include "debug.h"
 
+/**
+ * Connection parameters of the last successful connection, kept in RTC memory across
+ * resets and radio sleeps, so reconnecting skips the scan and DHCP. The lease is reused
+ * as a static configuration and dropped as soon as a fast reconnection fails.
+ */
+struct WifiCache
+{
+    uint32_t crc;     // Of the fields below
+    uint32_t ssidCrc; // Of the SSID the parameters belong to
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint8_t padding;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns;
+};
+
 class WifiManager
 {
 private:
-    static const int MAX_CONNECTION_ATTEMPTS = 100;
+    static const unsigned long CONNECTION_TIMEOUT = 10000;   // ms
+    static const unsigned long MIN_BACKOFF = 5000;           // ms
+    static const unsigned long MAX_BACKOFF = 5 * 60 * 1000;  // ms
+    static const uint32_t WIFI_CACHE_RTC_OFFSET = 0;         // In 4 byte blocks
+    static const unsigned long EVENTS_PAGE_SIZE = 100;       // Events per /events response by default
+
+    enum ConnectionState
+    {
+        DISCONNECTED,
+        CONNECTING,
+        CONNECTED,
+        BACKOFF
+    };
+
     const IPAddress _apIP;
     const char *_apSSID = "SunsetinoTimer";
     boolean _isSetupMode = false;
     unsigned long _lastConnection = 0;
     bool _forceReset = false;
+    ConnectionState _state = DISCONNECTED;
+    unsigned long _stateSince = 0;
+    unsigned long _backoff = MIN_BACKOFF;
+    bool _fastConnect = false;    // The current attempt uses the cache
+    bool _everConnected = false;  // Since boot
+    bool _scanning = false;       // Setup mode, the access point starts once the scan is over
+    WifiCache _cache;
     String _ssidList;
     DNSServer _dnsServer;
     ESP8266WebServer *const _webServer;
@@ -31,14 +69,25 @@ private:
     EventLogger *const _eventLogger;
 
     boolean RestoreConfig();
+    void Connect();
+    void SuperviseConnection();
+    void SetState(ConnectionState state);
+    bool LoadCache();
+    void SaveCache();
+    void InvalidateCache();
     void ConfigureWebServer();
+    void ConfigureSetupRoutes();
     void SetupMode();
+    void StartAccessPoint();
     String MakePage(String title, String contents);
     String UrlDecode(String input);
+    static String FormatMonthDay(uint16_t monthDay);
+    static uint16_t ParseMonthDay(const String &monthDay);
     void OnSettings();
     void OnSaveSettings();
     void OnSetAp();
     void OnReset();
+    void OnEvents();
 
 public:
     WifiManager(ESP8266WebServer *webServer,
@@ -49,8 +98,8 @@ public:
     ~WifiManager();
     void Setup();
     void HandleClient();
-    bool CheckConnection();
     bool IsSetupMode();
+    bool IsConnected();
     boolean IsWifiOn();
     void TurnWifiOn();
     void WifiHousekeeping();
@@ -76,10 +125,10 @@ WifiManager::~WifiManager()
 
 void WifiManager::Setup()
 {
-    EEPROM.begin(512);
+    WiFi.persistent(false); // Credentials come from PersistentConfiguration, don't wear the flash
     WiFi.mode(WIFI_STA);
     delay(10);
-    if (!(RestoreConfig() && CheckConnection()))
+    if (!RestoreConfig())
     {
         LOGDEBUGLN(F("Running in setup mode"));
         SetupMode();
@@ -90,7 +139,12 @@ void WifiManager::Setup()
 
 void WifiManager::HandleClient()
 {
-    if (_isSetupMode)
+    if (_scanning)
+    {
+        if (WiFi.scanComplete() != WIFI_SCAN_RUNNING)
+            StartAccessPoint();
+    }
+    else if (_isSetupMode)
     {
         _dnsServer.processNextRequest();
     }
@@ -98,16 +152,13 @@ void WifiManager::HandleClient()
 
 boolean WifiManager::RestoreConfig()
 {
-    LOGDEBUGLN(F("\nReading EEPROM..."));
+    LOGDEBUGLN(F("\nReading configuration..."));
     String ssid = _persistentConfiguration->GetSSID();
-    String pass = _persistentConfiguration->GetPassword();
     if (!ssid.isEmpty())
     {
         LOGDEBUG(F("SSID: "));
         LOGDEBUGLN(ssid);
-        LOGDEBUG(F("Password: "));
-        LOGDEBUGLN(pass);
-        WiFi.begin(ssid.c_str(), pass.c_str());
+        Connect();
         return true;
     }
     else
@@ -117,19 +168,120 @@ boolean WifiManager::RestoreConfig()
     }
 }
 
-bool WifiManager::CheckConnection()
+void WifiManager::Connect()
+{
+    String ssid = _persistentConfiguration->GetSSID();
+    String pass = _persistentConfiguration->GetPassword();
+
+    _fastConnect = LoadCache();
+    if (_fastConnect)
+    {
+        LOGDEBUGLN(F("Fast reconnect"));
+        WiFi.config(IPAddress(_cache.ip), IPAddress(_cache.gateway), IPAddress(_cache.subnet), IPAddress(_cache.dns));
+        WiFi.begin(ssid.c_str(), pass.c_str(), _cache.channel, _cache.bssid);
+    }
+    else
+    {
+        WiFi.config(0U, 0U, 0U); // DHCP
+        WiFi.begin(ssid.c_str(), pass.c_str());
+    }
+
+    SetState(CONNECTING);
+}
+
+/**
+ * Advances the connection state machine, never waits.
+ */
+void WifiManager::SuperviseConnection()
 {
-    int numAttempts;
-    for (numAttempts = 0;
-         WiFi.status() != WL_CONNECTED && numAttempts < MAX_CONNECTION_ATTEMPTS;
-         numAttempts++)
+    switch (_state)
     {
-        delay(250);
-        _platformManager->Blink();
-        LOGDEBUG(F("."));
+    case DISCONNECTED:
+        Connect();
+        break;
+
+    case CONNECTING:
+        if (WiFi.status() == WL_CONNECTED)
+        {
+            LOGDEBUGLN("Connected to " + WiFi.BSSIDstr() + ", IP " + WiFi.localIP().toString());
+            SaveCache();
+            _backoff = MIN_BACKOFF;
+            _everConnected = true;
+            SetState(CONNECTED);
+        }
+        else if (millis() - _stateSince >= CONNECTION_TIMEOUT)
+        {
+            if (_fastConnect)
+            {
+                // The access point or the lease changed: retry at once with scan and DHCP
+                InvalidateCache();
+                Connect();
+            }
+            else if (!_everConnected)
+            {
+                // Credentials may be wrong, as at boot before the supervisor
+                LOGDEBUGLN(F("Running in setup mode"));
+                SetupMode();
+                ConfigureSetupRoutes();
+            }
+            else
+            {
+                _eventLogger->LogEvent(EVENT_WIFI_FAILED, _backoff / 1000);
+                WiFi.disconnect();
+                SetState(BACKOFF);
+            }
+        }
+        break;
+
+    case CONNECTED:
+        // The SDK reconnects by itself, give it the same time as a new connection
+        if (WiFi.status() != WL_CONNECTED)
+            SetState(CONNECTING);
+        break;
+
+    case BACKOFF:
+        if (millis() - _stateSince >= _backoff)
+        {
+            _backoff = 2 * _backoff < MAX_BACKOFF ? 2 * _backoff : MAX_BACKOFF;
+            Connect();
+        }
+        break;
     }
+}
+
+void WifiManager::SetState(ConnectionState state)
+{
+    _state = state;
+    _stateSince = millis();
+}
 
-    return numAttempts < MAX_CONNECTION_ATTEMPTS;
+bool WifiManager::LoadCache()
+{
+    String ssid = _persistentConfiguration->GetSSID();
+    return ESP.rtcUserMemoryRead(WIFI_CACHE_RTC_OFFSET, (uint32_t *)&_cache, sizeof(_cache)) &&
+           _cache.crc == crc32((uint8_t *)&_cache + sizeof(_cache.crc), sizeof(_cache) - sizeof(_cache.crc)) &&
+           _cache.ssidCrc == crc32(ssid.c_str(), ssid.length());
+}
+
+void WifiManager::SaveCache()
+{
+    String ssid = _persistentConfiguration->GetSSID();
+    _cache.ssidCrc = crc32(ssid.c_str(), ssid.length());
+    memcpy(_cache.bssid, WiFi.BSSID(), sizeof(_cache.bssid));
+    _cache.channel = WiFi.channel();
+    _cache.padding = 0;
+    _cache.ip = WiFi.localIP();
+    _cache.gateway = WiFi.gatewayIP();
+    _cache.subnet = WiFi.subnetMask();
+    _cache.dns = WiFi.dnsIP();
+    _cache.crc = crc32((uint8_t *)&_cache + sizeof(_cache.crc), sizeof(_cache) - sizeof(_cache.crc));
+    ESP.rtcUserMemoryWrite(WIFI_CACHE_RTC_OFFSET, (uint32_t *)&_cache, sizeof(_cache));
+}
+
+void WifiManager::InvalidateCache()
+{
+    _cache.crc = ~_cache.crc;
+    ESP.rtcUserMemoryWrite(WIFI_CACHE_RTC_OFFSET, (uint32_t *)&_cache, sizeof(_cache));
 }
 
 bool WifiManager::IsSetupMode()
@@ -137,12 +289,19 @@ bool WifiManager::IsSetupMode()
     return _isSetupMode;
 }
 
+bool WifiManager::IsConnected()
+{
+    return _state == CONNECTED;
+}
+
+/**
+ * Registers the routes once, at setup. OnSettings() serves the page of the current mode.
+ */
 void WifiManager::ConfigureWebServer()
 {
     if (_isSetupMode)
     {
-        _webServer->on(F("/settings"), [this]() { OnSettings(); });
-        _webServer->on(F("/set-ap"), [this]() { OnSetAp(); });
+        ConfigureSetupRoutes();
     }
     else
     {
@@ -150,9 +309,19 @@ void WifiManager::ConfigureWebServer()
         _webServer->on(F("/reset"), [this]() { OnReset(); });
     }
 
+    _webServer->on(F("/events"), [this]() { OnEvents(); });
     _webServer->onNotFound([this]() { OnSettings(); });
 }
 
+/**
+ * Adds the routes of setup mode, also when entering it after setup
+ */
+void WifiManager::ConfigureSetupRoutes()
+{
+    _webServer->on(F("/settings"), [this]() { OnSettings(); });
+    _webServer->on(F("/set-ap"), [this]() { OnSetAp(); });
+}
+
 void WifiManager::OnSettings()
 {
     _platformManager->Blink();
@@ -182,6 +351,7 @@ void WifiManager::OnSettings()
                          "<option value='0' " + (intv.onType == 0 ? "selected" : "") + ">Specific time</option>"
                          "<option value='1' " + (intv.onType == 1 ? "selected" : "") + ">Sunrise</option>"
                          "<option value='2' " + (intv.onType == 2 ? "selected" : "") + ">Sunset</option>"
+                         "<option value='3' " + (intv.onType == 3 ? "selected" : "") + ">Irradiance below threshold</option>"
                          "</select>"
                          "<input type='time' id='onTime" + String(i) + "' name='onTime" + String(i) + "' value='" + strOn + "'/>"
                          "<br/>"
@@ -190,8 +360,34 @@ void WifiManager::OnSettings()
                          "<option value='0' " + (intv.offType == 0 ? "selected" : "") + ">Specific time</option>"
                          "<option value='1' " + (intv.offType == 1 ? "selected" : "") + ">Sunrise</option>"
                          "<option value='2' " + (intv.offType == 2 ? "selected" : "") + ">Sunset</option>"
+                         "<option value='3' " + (intv.offType == 3 ? "selected" : "") + ">Irradiance above threshold</option>"
                          "</select>"
-                         "<input type='time' id='offTime" + String(i) + "' name='offTime" + String(i) + "' value='" + strOff + "'/>"
+                         "<input type='time' id='offTime" + String(i) + "' name='offTime" + String(i) + "' value='" + strOff + "'/>";
+#if NUM_CHANNELS > 1
+            intervals += "<br/><span class='label'>Channels</span>";
+            ChannelMask channels = intv.channels & ((1UL << NUM_CHANNELS) - 1);
+            for (int c = 0; c < NUM_CHANNELS; c++)
+            {
+                String name = "ch" + String(i) + "_" + String(c);
+                bool checked = channels ? channels >> c & 1 : c == 0;
+                intervals += "<input type='checkbox' id='" + name + "' name='" + name + "' value='1' " +
+                             (checked ? "checked" : "") + "/><label for='" + name + "'>" + String(c + 1) + "</label> ";
+            }
+#endif
+            static const char *const weekdayNames[] = {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"};
+            // The hidden field tells no day checked from a form without days
+            intervals += "<br/><span class='label'>Days</span><input type='hidden' name='wd" + String(i) + "' value='1'/>";
+            for (int d = 0; d < 7; d++)
+            {
+                String name = "wd" + String(i) + "_" + String(d);
+                bool checked = !intv.weekdays || intv.weekdays >> d & 1;
+                intervals += "<input type='checkbox' id='" + name + "' name='" + name + "' value='1' " +
+                             (checked ? "checked" : "") + "/><label for='" + name + "'>" + weekdayNames[d] + "</label> ";
+            }
+            intervals += "<br/>"
+                         "<span class='label'>Skip from/to (MM-DD)</span>"
+                         "<input type='text' size='5' pattern='\\d\\d-\\d\\d' name='skipFrom" + String(i) + "' value='" + FormatMonthDay(intv.skipFrom) + "'/> "
+                         "<input type='text' size='5' pattern='\\d\\d-\\d\\d' name='skipTo" + String(i) + "' value='" + FormatMonthDay(intv.skipTo) + "'/>"
                          "</p>"
                          "<br/>";
         }
@@ -224,12 +420,17 @@ void WifiManager::OnSettings()
         <input type="number" step="0.5" name="tzoff" id="tzoff" value=")=" +
                    String(_persistentConfiguration->GetTimezoneOffset(), 1) + R"=(">
     </p>
+    <p>
+        <label for="irrth" class="label">Irradiance threshold</label>
+        <input type="number" step="0.01" min="0" max="1" name="irrth" id="irrth" value=")=" +
+                   String(_persistentConfiguration->GetIrradianceThreshold(), 2) + R"=(">
+    </p>
     <br/>
 )=" + intervals + R"=(
     <input type="submit"/>
 </form>
 <h4>Events</h4>
-<pre>)=" + _eventLogger->PrintEvents() + R"=(</pre>
+<p><a href="/events">Event log</a></p>
  )=";
         _webServer->send(200, F("text/html"), MakePage(F("Platform Settings"), s));
     }
@@ -254,6 +455,7 @@ void WifiManager::OnSetAp()
     s += F("\" after the restart.</p>");
     _webServer->send(200, F("text/html"), MakePage(F("Wi-Fi Settings"), s));
     _platformManager->Blink();
+    _eventLogger->Flush();
     ESP.restart();
 }
 
@@ -276,6 +478,11 @@ void WifiManager::OnSaveSettings()
     _timeClient->setTimeOffset(tzOffset * 60 * 60);
     LOGDEBUGLN("Timezone offset: " + String(tzOffset, 1));
 
+    // Irradiance threshold
+    float irradianceThreshold = atof(UrlDecode(_webServer->arg(F("irrth"))).c_str());
+    _persistentConfiguration->SetIrradianceThreshold(irradianceThreshold);
+    LOGDEBUGLN("Irradiance threshold: " + String(irradianceThreshold, 2));
+
     // Intervals
     for (int i = 0; i < NUM_INTERVALS; i++)
     {
@@ -305,13 +512,40 @@ void WifiManager::OnSaveSettings()
         }
         ti.offType = ttOff;
 
+        // Channels
+        ti.channels = 1;
+#if NUM_CHANNELS > 1
+        ti.channels = 0;
+        for (int c = 0; c < NUM_CHANNELS; c++)
+        {
+            if (_webServer->hasArg("ch" + String(i) + "_" + String(c)))
+                ti.channels |= 1 << c;
+        }
+        LOGDEBUGLN("channels" + String(i) + ": " + String(ti.channels, BIN))
+#endif
+
+        // Days: every day if all are checked or the form has none, no day if none is checked
+        for (int d = 0; d < 7; d++)
+        {
+            if (_webServer->hasArg("wd" + String(i) + "_" + String(d)))
+                ti.weekdays |= 1 << d;
+        }
+        if (ti.weekdays == 0x7F || !_webServer->hasArg("wd" + String(i)))
+            ti.weekdays = 0;
+        else if (ti.weekdays == 0)
+            ti.weekdays = NO_WEEKDAYS;
+        ti.skipFrom = ParseMonthDay(UrlDecode(_webServer->arg("skipFrom" + String(i))));
+        ti.skipTo = ParseMonthDay(UrlDecode(_webServer->arg("skipTo" + String(i))));
+        LOGDEBUGLN("weekdays" + String(i) + ": " + String(ti.weekdays, BIN))
+        LOGDEBUGLN("skip" + String(i) + ": " + String(ti.skipFrom) + "-" + String(ti.skipTo))
+
         _persistentConfiguration->SetTimerInterval(i, ti);
     }
     
     _persistentConfiguration->SaveConfiguration();
     String s = F("<h1>Configuration saved.</h1><p><a href=\"/\">Go back to settings.</a></p>");
     _webServer->send(200, F("text/html"), MakePage(F("Configuration saved"), s));
-    _eventLogger->LogEvent(F("Configuration changed."));
+    _eventLogger->LogEvent(EVENT_CONFIGURATION_CHANGED);
     _platformManager->Blink();
 }
 
@@ -322,20 +556,65 @@ void WifiManager::OnReset()
     String s = F("<h1>Platform reset.</h1><p>The device is going to reboot now.</p>");
     _webServer->send(200, F("text/html"), MakePage(F("Platform reset"), s));
     _platformManager->Blink();
+    _eventLogger->Flush();
     ESP.restart();
 }
 
+/**
+ * Streams the event log as text, oldest first, starting at the event numbered by the
+ * since argument (the oldest if missing or overwritten), at most limit events. The
+ * X-Next-Since header is the since of the following page.
+ */
+void WifiManager::OnEvents()
+{
+    // Events are numbered by the journal: once served they are in flash, so a restart
+    // never gives their numbers to other events and a poller's since stays valid
+    _eventLogger->Flush();
+
+    unsigned long first = _eventLogger->FirstSequence();
+    unsigned long next = _eventLogger->NextSequence();
+    unsigned long sequence = first;
+    if (_webServer->hasArg(F("since")))
+        sequence = strtoul(_webServer->arg(F("since")).c_str(), nullptr, 10);
+    if (sequence < first || sequence > next)
+        sequence = first;
+
+    unsigned long limit = EVENTS_PAGE_SIZE;
+    if (_webServer->hasArg(F("limit")))
+        limit = strtoul(_webServer->arg(F("limit")).c_str(), nullptr, 10);
+    unsigned long end = next - sequence > limit ? sequence + limit : next;
+
+    _webServer->sendHeader(F("X-Next-Since"), String(end));
+    _webServer->setContentLength(CONTENT_LENGTH_UNKNOWN);
+    _webServer->send(200, F("text/plain"), "");
+
+    char buffer[512];
+    size_t length;
+    while ((length = _eventLogger->PrintEvents(sequence, end, buffer, sizeof(buffer))) > 0)
+        _webServer->sendContent(buffer, length);
+    _webServer->sendContent("");
+}
+
+/**
+ * Scans the networks for the settings page, without waiting: HandleClient() starts the
+ * access point when the scan is over.
+ */
 void WifiManager::SetupMode()
 {
     _isSetupMode = true;
     WiFi.mode(WIFI_STA);
     WiFi.disconnect();
-    delay(100);
-    _platformManager->Blink(50, 10);
-    int n = WiFi.scanNetworks();
-    delay(100);
     _platformManager->Blink(50, 10);
+    WiFi.scanNetworks(true);
+    _scanning = true;
+}
+
+void WifiManager::StartAccessPoint()
+{
+    _scanning = false;
+    int n = WiFi.scanComplete();
     LOGDEBUGLN("");
+    _ssidList = "";
     for (int i = 0; i < n; ++i)
     {
         _ssidList += F("<option value=\"");
@@ -344,7 +623,9 @@ void WifiManager::SetupMode()
         _ssidList += WiFi.SSID(i);
         _ssidList += F("</option>");
     }
-    delay(100);
+    WiFi.scanDelete();
+
+    _platformManager->Blink(50, 10);
     WiFi.mode(WIFI_AP);
     WiFi.softAPConfig(_apIP, _apIP, IPAddress(255, 255, 255, 0));
     WiFi.softAP(_apSSID);
@@ -370,32 +651,30 @@ void WifiManager::WifiHousekeeping()
         // Awake WiFi if it was sleeping
         if (WiFi.getMode() == WIFI_OFF)
         {
-            _eventLogger->LogEvent(F("WiFi active."));
+            _eventLogger->LogEvent(EVENT_WIFI_ACTIVE);
             WiFi.forceSleepWake();
             delay(1);
             WiFi.mode(WIFI_STA);
-            WiFi.begin();
+            SetState(DISCONNECTED);
             _lastConnection = millis();
         }
 
-        if (!CheckConnection())
-        {
-            _platformManager->Blink(50, 50);
-        }
-        else
-        {
+        SuperviseConnection();
+        if (_state == CONNECTED)
             _platformManager->Blink(5);
-        }
+        else if (_state == CONNECTING)
+            _platformManager->Blink();
     }
     else
     {
         // Put WiFi to sleep only if in STA mode
         if (WiFi.getMode() == WIFI_STA)
         {
-            _eventLogger->LogEvent(F("WiFi inactive."));
+            _eventLogger->LogEvent(EVENT_WIFI_INACTIVE);
             WiFi.mode(WIFI_OFF);
             WiFi.forceSleepBegin();
             delay(1);
+            SetState(DISCONNECTED);
         }
     }
 }
@@ -423,6 +702,28 @@ String WifiManager::MakePage(String title, String contents)
     return s;
 }
 
+String WifiManager::FormatMonthDay(uint16_t monthDay)
+{
+    if (!monthDay)
+        return "";
+
+    return (monthDay / 100 < 10 ? "0" : "") + String(monthDay / 100) + "-" +
+           (monthDay % 100 < 10 ? "0" : "") + String(monthDay % 100);
+}
+
+uint16_t WifiManager::ParseMonthDay(const String &monthDay)
+{
+    if (monthDay.length() != 5)
+        return 0;
+
+    int month = atoi(monthDay.substring(0, 2).c_str());
+    int day = atoi(monthDay.substring(3, 5).c_str());
+    if (month < 1 || month > 12 || day < 1 || day > 31)
+        return 0;
+
+    return month * 100 + day;
+}
+
 String WifiManager::UrlDecode(String input)
 {
     String s = input;
@@ -3,12 +3,44 @@
 
 #define NTP_UPDATE_INTERVAL 7 * 24 * 60 * 60 * 1000
 
+// Queried together on every update, up to NTP_MAX_SERVERS
+#ifndef NTP_SERVERS
+#define NTP_SERVERS {"0.pool.ntp.org", "1.pool.ntp.org", "2.pool.ntp.org", "time.nist.gov"}
+#endif
+
+// Define BITMAP_SCHEDULE to use the minute-of-day bitmap schedule, whose memory
+// and lookup cost do not grow with NUM_INTERVALS. The intervals are still all kept in
+// the configuration and listed on the settings page, which bound how many fit.
 #ifndef NUM_INTERVALS
 #define NUM_INTERVALS 4
 #endif
 
+// Relay channels, up to 16, and their pins in channel order
+#ifndef NUM_CHANNELS
+#define NUM_CHANNELS 1
+#endif
+
+#ifndef LAMP_PINS
+#define LAMP_PINS {D1}
+#endif
+
+// Loop period while WiFi is on, the web server is polled
+#define WIFI_ON_LOOP_INTERVAL 500
+
+// Delay before retrying a failed NTP update
+#define NTP_RETRY_INTERVAL 3000
+
+// Events kept in the log, 8 bytes each
 #ifndef NUM_EVENTS
-#define NUM_EVENTS 100
+#define NUM_EVENTS 1000
 #endif
 
+// Flash sectors of the event journal, 4 KB each, taken from the filesystem partition
+#ifndef JOURNAL_SECTORS
+#define JOURNAL_SECTORS 8
+#endif
+
+// Maximum time an event stays in RAM before being written to flash
+#define JOURNAL_FLUSH_DELAY 60000
+
 #endif
\ No newline at end of file
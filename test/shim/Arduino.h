@@ -0,0 +1,276 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+/**
+ * Host stand-in for the parts of the ESP8266 Arduino core the firmware uses, for the
+ * native tests. Time is virtual: millis() only advances in delay(), esp_delay() and
+ * sim::Advance(), which run on the way the interrupts and SDK callbacks that fall due.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define ARDUINO_ARCH_ESP8266
+
+#define F(string) (string)
+#define PROGMEM
+#define ICACHE_RAM_ATTR
+#define IRAM_ATTR
+
+#define LOW 0
+#define HIGH 1
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define FALLING 2
+#define BIN 2
+#define DEC 10
+#define HEX 16
+
+#define D0 16
+#define D1 5
+#define D2 4
+#define D3 0
+#define D4 2
+#define D5 14
+#define D6 12
+#define D7 13
+#define D8 15
+#define NUM_PINS 17
+#define digitalPinToInterrupt(pin) (pin)
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+class String : public std::string
+{
+public:
+    String() {}
+    String(const char *s) : std::string(s ? s : "") {}
+    String(const std::string &s) : std::string(s) {}
+    explicit String(char c) : std::string(1, c) {}
+    String(int value, unsigned char base = DEC) : String((long)value, base) {}
+    String(unsigned int value, unsigned char base = DEC) : String((unsigned long)value, base) {}
+    String(long value, unsigned char base = DEC) : std::string(value < 0 ? "-" + Format((unsigned long)-value, base) : Format(value, base)) {}
+    String(unsigned long value, unsigned char base = DEC) : std::string(Format(value, base)) {}
+    String(float value, unsigned char decimals = 2) : String((double)value, decimals) {}
+    String(double value, unsigned char decimals = 2)
+    {
+        char buffer[64];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        assign(buffer);
+    }
+
+    bool isEmpty() const { return empty(); }
+    String substring(size_t from, size_t to = npos) const { return from < size() ? substr(from, to - from) : ""; }
+    long toInt() const { return atol(c_str()); }
+    float toFloat() const { return atof(c_str()); }
+    bool startsWith(const String &prefix) const { return compare(0, prefix.size(), prefix) == 0; }
+    int indexOf(const String &s) const { return (int)find(s); }
+
+    void replace(const String &from, const String &to)
+    {
+        if (from.empty())
+            return;
+        for (size_t i = find(from); i != npos; i = find(from, i + to.size()))
+            std::string::replace(i, from.size(), to);
+    }
+
+private:
+    static std::string Format(unsigned long value, unsigned char base)
+    {
+        std::string digits;
+        do
+        {
+            digits.insert(digits.begin(), "0123456789ABCDEF"[value % base]);
+            value /= base;
+        } while (value);
+        return digits;
+    }
+};
+
+namespace sim
+{
+    /// Virtual clock
+    inline unsigned long now = 0;
+
+    /// Interrupts and SDK callbacks, by the millis() they are due at
+    inline std::multimap<unsigned long, std::function<void()>> events;
+
+    inline void At(unsigned long time, std::function<void()> callback) { events.emplace(time, std::move(callback)); }
+
+    /// Runs the events that are due, as the SDK does whenever the sketch yields
+    inline void Service()
+    {
+        while (!events.empty() && events.begin()->first <= now)
+        {
+            std::function<void()> callback = std::move(events.begin()->second);
+            events.erase(events.begin());
+            callback();
+        }
+    }
+
+    /// Advances the clock up to until, or to the first event after which stop() holds
+    template <typename T>
+    void AdvanceUntil(unsigned long until, T &&stop)
+    {
+        Service();
+        while (!stop() && now < until)
+        {
+            unsigned long next = events.empty() || events.begin()->first > until ? until : events.begin()->first;
+            if (next > now)
+                now = next;
+            Service();
+        }
+    }
+
+    inline void Advance(unsigned long ms)
+    {
+        AdvanceUntil(now + ms, []() { return false; });
+    }
+
+    /// Pins
+    inline int pinModes[NUM_PINS];
+    inline int pinStates[NUM_PINS];
+    inline void (*interrupts[NUM_PINS])();
+    inline std::function<void(uint8_t pin, uint8_t value)> onDigitalWrite;
+
+    /// Raises the interrupt attached to the pin at the given time
+    inline void Interrupt(uint8_t pin, unsigned long time)
+    {
+        At(time, [pin]() {
+            if (interrupts[pin])
+                interrupts[pin]();
+        });
+    }
+
+    /// Serial output, kept for the tests to inspect
+    inline std::string serial;
+
+    /// Thrown by ESP.restart(), which does not return
+    struct Restart
+    {
+    };
+    inline unsigned int restarts = 0;
+
+    /// Flash chip, erased at start
+    static const uint32_t FLASH_SIZE = 4 * 1024 * 1024;
+    static const uint32_t FLASH_SECTOR_SIZE = 4096;
+
+    inline std::vector<uint8_t> &Flash()
+    {
+        static std::vector<uint8_t> flash(FLASH_SIZE, 0xFF);
+        return flash;
+    }
+
+    inline std::map<uint32_t, unsigned long> flashErases; // By sector
+    inline uint8_t rtcMemory[512];
+}
+
+inline unsigned long millis() { return sim::now; }
+inline unsigned long micros() { return sim::now * 1000; }
+inline void delay(unsigned long ms) { sim::Advance(ms); }
+inline void yield() { sim::Service(); }
+
+inline void pinMode(uint8_t pin, uint8_t mode) { sim::pinModes[pin] = mode; }
+
+inline void digitalWrite(uint8_t pin, uint8_t value)
+{
+    sim::pinStates[pin] = value;
+    if (sim::onDigitalWrite)
+        sim::onDigitalWrite(pin, value);
+}
+
+inline int digitalRead(uint8_t pin) { return sim::pinStates[pin]; }
+
+inline void attachInterrupt(uint8_t pin, void (*isr)(), int mode) { sim::interrupts[pin] = isr; }
+inline void detachInterrupt(uint8_t pin) { sim::interrupts[pin] = nullptr; }
+
+class HardwareSerial
+{
+public:
+    void begin(unsigned long baud) {}
+
+    template <typename T>
+    size_t print(const T &value)
+    {
+        std::ostringstream text;
+        text << value;
+        sim::serial += text.str();
+        return text.str().size();
+    }
+
+    template <typename T>
+    size_t println(const T &value) { return print(value) + print("\n"); }
+    size_t println() { return print("\n"); }
+};
+
+inline HardwareSerial Serial;
+
+class EspClass
+{
+public:
+    [[noreturn]] void restart()
+    {
+        sim::restarts++;
+        throw sim::Restart();
+    }
+
+    bool flashRead(uint32_t address, uint32_t *data, size_t size)
+    {
+        if (address % 4 || size % 4 || address + size > sim::FLASH_SIZE)
+            return false;
+        memcpy(data, sim::Flash().data() + address, size);
+        return true;
+    }
+
+    // NOR flash: a write only clears bits
+    bool flashWrite(uint32_t address, const uint32_t *data, size_t size)
+    {
+        if (address % 4 || size % 4 || address + size > sim::FLASH_SIZE)
+            return false;
+        const uint8_t *bytes = (const uint8_t *)data;
+        for (size_t i = 0; i < size; i++)
+            sim::Flash()[address + i] &= bytes[i];
+        return true;
+    }
+
+    bool flashEraseSector(uint32_t sector)
+    {
+        if ((sector + 1) * sim::FLASH_SECTOR_SIZE > sim::FLASH_SIZE)
+            return false;
+        memset(sim::Flash().data() + sector * sim::FLASH_SECTOR_SIZE, 0xFF, sim::FLASH_SECTOR_SIZE);
+        sim::flashErases[sector]++;
+        return true;
+    }
+
+    // Offset in 4 byte blocks
+    bool rtcUserMemoryRead(uint32_t offset, uint32_t *data, size_t size)
+    {
+        if (offset * 4 + size > sizeof(sim::rtcMemory))
+            return false;
+        memcpy(data, sim::rtcMemory + offset * 4, size);
+        return true;
+    }
+
+    bool rtcUserMemoryWrite(uint32_t offset, uint32_t *data, size_t size)
+    {
+        if (offset * 4 + size > sizeof(sim::rtcMemory))
+            return false;
+        memcpy(sim::rtcMemory + offset * 4, data, size);
+        return true;
+    }
+};
+
+inline EspClass ESP;
+
+#endif
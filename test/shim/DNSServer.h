@@ -0,0 +1,15 @@
+#ifndef DNSSERVER_H
+#define DNSSERVER_H
+
+#include <Arduino.h>
+#include "IPAddress.h"
+
+class DNSServer
+{
+public:
+    bool start(uint16_t port, const String &domainName, const IPAddress &resolvedIP) { return true; }
+    void processNextRequest() {}
+    void stop() {}
+};
+
+#endif
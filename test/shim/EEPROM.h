@@ -0,0 +1,96 @@
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include <Arduino.h>
+
+namespace sim
+{
+    static const size_t EEPROM_SIZE = 4096;
+
+    /// Flash sector behind the EEPROM emulation, erased at start
+    inline uint8_t *Eeprom()
+    {
+        static std::vector<uint8_t> sector(EEPROM_SIZE, 0xFF);
+        return sector.data();
+    }
+
+    inline unsigned long eepromCommits = 0;
+}
+
+/**
+ * Works on a RAM copy of the sector like the core: commit() and end() write it back.
+ */
+class EEPROMClass
+{
+public:
+    void begin(size_t size)
+    {
+        _size = size < sim::EEPROM_SIZE ? size : sim::EEPROM_SIZE;
+        memcpy(_data, sim::Eeprom(), _size);
+    }
+
+    template <typename T>
+    T &get(int address, T &value)
+    {
+        if (address + sizeof(T) <= _size)
+            memcpy(&value, _data + address, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    const T &put(int address, const T &value)
+    {
+        if (address + sizeof(T) <= _size)
+        {
+            memcpy(_data + address, &value, sizeof(T));
+            _dirty = true;
+        }
+        return value;
+    }
+
+    uint8_t read(int address) { return address < (int)_size ? _data[address] : 0; }
+
+    void write(int address, uint8_t value)
+    {
+        if (address < (int)_size)
+        {
+            _data[address] = value;
+            _dirty = true;
+        }
+    }
+
+    bool commit()
+    {
+        if (!_size)
+            return false;
+        if (_dirty)
+        {
+            memcpy(sim::Eeprom(), _data, _size);
+            sim::eepromCommits++;
+            _dirty = false;
+        }
+        return true;
+    }
+
+    bool end()
+    {
+        bool committed = commit();
+        _size = 0;
+        return committed;
+    }
+
+    uint8_t *getDataPtr()
+    {
+        _dirty = true;
+        return _data;
+    }
+
+private:
+    uint8_t _data[sim::EEPROM_SIZE];
+    size_t _size = 0;
+    bool _dirty = false;
+};
+
+inline EEPROMClass EEPROM;
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef ESP8266WEBSERVER_H
+#define ESP8266WEBSERVER_H
+
+#include <Arduino.h>
+#include <functional>
+#include <map>
+#include <vector>
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+/**
+ * Web server driven by the tests: Request() runs the handler of a path as handleClient()
+ * would, the first registered one like the core, and returns the response.
+ */
+class ESP8266WebServer
+{
+public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    struct Response
+    {
+        int code = 0;
+        String contentType;
+        String body;
+        std::map<String, String> headers;
+    };
+
+    ESP8266WebServer(int port = 80) {}
+
+    void begin() {}
+    void handleClient() {}
+
+    void on(const String &uri, THandlerFunction handler) { _routes.push_back({uri, handler}); }
+    void onNotFound(THandlerFunction handler) { _notFound = handler; } // Replaces, like the core
+
+    void send(int code, const String &contentType, const String &content)
+    {
+        _response.code = code;
+        _response.contentType = contentType;
+        _response.headers.insert(_pendingHeaders.begin(), _pendingHeaders.end());
+        _pendingHeaders.clear();
+        _response.body += content;
+    }
+
+    void sendHeader(const String &name, const String &value, bool first = false) { _pendingHeaders[name] = value; }
+    void setContentLength(size_t length) {}
+    void sendContent(const String &content) { _response.body += content; }
+    void sendContent(const char *content, size_t size) { _response.body.append(content, size); }
+
+    bool hasArg(const String &name) { return _args.count(name) != 0; }
+    String arg(const String &name) { return hasArg(name) ? _args[name] : String(); }
+
+    Response Request(const String &uri, const std::map<String, String> &args = {})
+    {
+        _response = Response();
+        _args = args;
+        for (const Route &route : _routes)
+        {
+            if (route.uri == uri)
+            {
+                route.handler();
+                return _response;
+            }
+        }
+        if (_notFound)
+            _notFound();
+        return _response;
+    }
+
+    /// Handlers registered for the path, all but the first are never reached
+    size_t Routes(const String &uri)
+    {
+        size_t count = 0;
+        for (const Route &route : _routes)
+            count += route.uri == uri;
+        return count;
+    }
+
+private:
+    struct Route
+    {
+        String uri;
+        THandlerFunction handler;
+    };
+
+    std::vector<Route> _routes;
+    THandlerFunction _notFound;
+    std::map<String, String> _args;
+    std::map<String, String> _pendingHeaders;
+    Response _response;
+};
+
+#endif
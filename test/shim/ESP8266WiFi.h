@@ -0,0 +1,222 @@
+#ifndef ESP8266WIFI_H
+#define ESP8266WIFI_H
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include "IPAddress.h"
+#include "lwip/ip_addr.h"
+
+typedef enum
+{
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} WiFiMode_t;
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_SCAN_COMPLETED = 2,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_WRONG_PASSWORD = 6,
+    WL_DISCONNECTED = 7
+} wl_status_t;
+
+#define WIFI_SCAN_RUNNING (-1)
+#define WIFI_SCAN_FAILED (-2)
+
+typedef int8_t err_t;
+#define ERR_OK 0
+#define ERR_INPROGRESS -5
+#define ERR_VAL -6
+typedef void (*dns_found_callback)(const char *name, const ip_addr_t *ipaddr, void *callback_arg);
+
+namespace sim
+{
+    /// The access point in range
+    inline std::string apSsid = "Home";
+    inline std::string apPassword = "password";
+    inline bool apAvailable = true;
+    inline unsigned long connectTime = 3000; // ms from WiFi.begin()
+    inline std::vector<std::string> scanResults = {"Home", "Neighbour"};
+    inline unsigned long scanTime = 2500; // ms
+
+    /// Name server behind it
+    inline std::map<std::string, IPAddress> dnsRecords;
+    inline unsigned long dnsDelay = 30;      // ms to answer
+    inline unsigned long dnsTimeout = 10000; // ms before giving up when down
+    inline bool dnsDown = false;
+    inline unsigned long blockingLookups = 0; // WiFi.hostByName() calls
+    inline unsigned long lookups = 0;         // dns_gethostbyname() calls
+}
+
+class ESP8266WiFiClass
+{
+public:
+    void persistent(bool persistent) {}
+
+    bool mode(WiFiMode_t mode)
+    {
+        _mode = mode;
+        if (!(mode & WIFI_STA))
+            _begun = false;
+        return true;
+    }
+
+    WiFiMode_t getMode() { return _mode; }
+
+    wl_status_t begin(const char *ssid, const char *password = nullptr, int32_t channel = 0,
+                      const uint8_t *bssid = nullptr, bool connect = true)
+    {
+        _ssid = ssid;
+        _password = password ? password : "";
+        _begun = true;
+        _beginAt = millis();
+        _mode = (WiFiMode_t)(_mode | WIFI_STA);
+        return status();
+    }
+
+    bool config(IPAddress local, IPAddress gateway, IPAddress subnet, IPAddress dns1 = (uint32_t)0,
+                IPAddress dns2 = (uint32_t)0) { return true; }
+
+    bool disconnect(bool wifiOff = false)
+    {
+        _begun = false;
+        return true;
+    }
+
+    // The SDK reconnects by itself when the access point comes back
+    wl_status_t status()
+    {
+        if (!(_mode & WIFI_STA) || !_begun || _sleeping)
+            return WL_DISCONNECTED;
+        if (!sim::apAvailable || _ssid != sim::apSsid)
+            return WL_NO_SSID_AVAIL;
+        if (millis() - _beginAt < sim::connectTime)
+            return WL_DISCONNECTED;
+        return _password == sim::apPassword ? WL_CONNECTED : WL_WRONG_PASSWORD;
+    }
+
+    bool forceSleepWake()
+    {
+        _sleeping = false;
+        return true;
+    }
+
+    bool forceSleepBegin(uint32_t sleepUs = 0)
+    {
+        _sleeping = true;
+        return true;
+    }
+
+    int8_t scanNetworks(bool async = false, bool showHidden = false)
+    {
+        _scanned = false;
+        _scanDoneAt = millis() + sim::scanTime;
+        if (async)
+        {
+            _scanning = true;
+            return WIFI_SCAN_RUNNING;
+        }
+        delay(sim::scanTime);
+        _scanned = true;
+        return sim::scanResults.size();
+    }
+
+    int8_t scanComplete()
+    {
+        if (_scanning && millis() >= _scanDoneAt)
+        {
+            _scanning = false;
+            _scanned = true;
+        }
+        if (_scanning)
+            return WIFI_SCAN_RUNNING;
+        return _scanned ? sim::scanResults.size() : WIFI_SCAN_FAILED;
+    }
+
+    void scanDelete() { _scanned = false; }
+
+    String SSID(uint8_t i) { return i < sim::scanResults.size() ? sim::scanResults[i] : ""; }
+    String SSID() { return _ssid; }
+
+    uint8_t *BSSID()
+    {
+        static uint8_t bssid[6] = {0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+        return bssid;
+    }
+
+    String BSSIDstr() { return "02:00:00:00:00:01"; }
+    int32_t channel() { return 6; }
+    IPAddress localIP() { return status() == WL_CONNECTED ? IPAddress(192, 168, 0, 50) : IPAddress(); }
+    IPAddress gatewayIP() { return IPAddress(192, 168, 0, 1); }
+    IPAddress subnetMask() { return IPAddress(255, 255, 255, 0); }
+    IPAddress dnsIP(uint8_t n = 0) { return IPAddress(192, 168, 0, 1); }
+
+    bool softAPConfig(IPAddress local, IPAddress gateway, IPAddress subnet) { return true; }
+    bool softAP(const char *ssid, const char *password = nullptr) { return true; }
+
+    // Blocks until the name server answers, like the core
+    int hostByName(const char *name, IPAddress &result, uint32_t timeout = 10000)
+    {
+        sim::blockingLookups++;
+        if (status() != WL_CONNECTED)
+            return 0;
+        if (sim::dnsDown)
+        {
+            delay(timeout);
+            return 0;
+        }
+
+        delay(sim::dnsDelay);
+        auto record = sim::dnsRecords.find(name);
+        if (record == sim::dnsRecords.end())
+            return 0;
+        result = record->second;
+        return 1;
+    }
+
+private:
+    WiFiMode_t _mode = WIFI_STA;
+    bool _begun = false;
+    bool _sleeping = false;
+    unsigned long _beginAt = 0;
+    std::string _ssid;
+    std::string _password;
+    bool _scanning = false;
+    bool _scanned = false;
+    unsigned long _scanDoneAt = 0;
+};
+
+inline ESP8266WiFiClass WiFi;
+
+/**
+ * lwIP asynchronous lookup, declared by lwip/dns.h: found is called later from the SDK,
+ * here as a sim event, with NULL if the name does not resolve.
+ */
+inline err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr, dns_found_callback found, void *callback_arg)
+{
+    sim::lookups++;
+    if (WiFi.status() != WL_CONNECTED)
+        return ERR_VAL;
+
+    std::string name = hostname;
+    sim::At(millis() + (sim::dnsDown ? sim::dnsTimeout : sim::dnsDelay), [name, found, callback_arg]() {
+        auto record = sim::dnsRecords.find(name);
+        if (sim::dnsDown || record == sim::dnsRecords.end())
+        {
+            found(name.c_str(), nullptr, callback_arg);
+            return;
+        }
+        ip_addr_t address = {(uint32_t)record->second};
+        found(name.c_str(), &address, callback_arg);
+    });
+    return ERR_INPROGRESS;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef IPADDRESS_H
+#define IPADDRESS_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <Arduino.h>
+#include "lwip/ip_addr.h"
+
+/**
+ * IPv4 address held in network byte order like lwIP: the first octet is the lowest byte.
+ */
+class IPAddress
+{
+public:
+    IPAddress() : _address(0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _address(a | b << 8 | c << 16 | (uint32_t)d << 24) {}
+    IPAddress(uint32_t address) : _address(address) {}
+    IPAddress(const ip_addr_t *address) : _address(address->addr) {}
+
+    operator uint32_t() const { return _address; }
+    uint8_t operator[](int index) const { return _address >> (8 * index); }
+    bool operator==(const IPAddress &other) const { return _address == other._address; }
+    bool operator!=(const IPAddress &other) const { return _address != other._address; }
+    bool isSet() const { return _address != 0; }
+
+    String toString() const
+    {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", (*this)[0], (*this)[1], (*this)[2], (*this)[3]);
+        return buffer;
+    }
+
+private:
+    uint32_t _address;
+};
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef NTPSERVER_H
+#define NTPSERVER_H
+
+#include <random>
+#include "WiFiUdp.h"
+
+namespace sim
+{
+    /// True UTC in ms when millis() was 0
+    inline uint64_t utcAtZero = 0;
+
+    /// Frequency error of the millis() crystal, e.g. 30e-6 if it runs 30 ppm slow
+    inline double crystalError = 0;
+
+    /// True UTC in ms, which the NTP servers serve
+    inline uint64_t Utc() { return utcAtZero + (uint64_t)(now * (1 + crystalError)); }
+
+    /**
+     * NTP server stand-in on the simulated network, registered in DNS under its name.
+     * Replies like a real server (mode 4, originate timestamp echoing the request transmit
+     * timestamp) after the network delay, unless the request or the reply is lost.
+     */
+    class NtpServer
+    {
+    public:
+        unsigned long delay = 20; // ms each way
+        unsigned long jitter = 0; // Up to this many ms more each way
+        double loss = 0;          // Probability a request goes unanswered
+        long offset = 0;          // ms the server clock is off
+        uint8_t stratum = 2;
+        bool online = true;
+        unsigned long requests = 0;
+        unsigned long replies = 0;
+
+        NtpServer(const char *name, IPAddress address) : _address(address), _random(address)
+        {
+            dnsRecords[name] = address;
+            udpHosts[address] = [this](const Datagram &request) { Receive(request); };
+        }
+
+        ~NtpServer() { udpHosts.erase(_address); }
+
+    private:
+        const IPAddress _address;
+        std::mt19937 _random;
+
+        unsigned long Delay() { return delay + (jitter ? _random() % (jitter + 1) : 0); }
+
+        void Receive(const Datagram &request)
+        {
+            requests++;
+            if (!online || request.data.size() < 48 || std::uniform_real_distribution<double>(0, 1)(_random) < loss)
+                return;
+
+            unsigned long in = Delay(), out = Delay();
+            std::vector<uint8_t> reply(48, 0);
+            reply[0] = 0x24; // No leap warning, version 4, server
+            reply[1] = stratum;
+            memcpy(reply.data() + 24, request.data.data() + 40, 8);
+            uint64_t received = Utc() + in + offset;
+            WriteTimestamp(reply.data() + 32, received);
+            WriteTimestamp(reply.data() + 40, received + 1);
+            replies++;
+            UdpReply(now + in + out, {request.address, 123, reply});
+        }
+
+        static void WriteTimestamp(uint8_t *timestamp, uint64_t utc)
+        {
+            uint32_t seconds = (uint32_t)(utc / 1000 + 2208988800ULL);
+            uint32_t fraction = (uint32_t)(((utc % 1000) << 32) / 1000);
+            for (int i = 0; i < 4; i++)
+            {
+                timestamp[i] = seconds >> (24 - 8 * i);
+                timestamp[4 + i] = fraction >> (24 - 8 * i);
+            }
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef WIFICLIENT_H
+#define WIFICLIENT_H
+
+class WiFiClient
+{
+};
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef WIFIUDP_H
+#define WIFIUDP_H
+
+#include <Arduino.h>
+#include <deque>
+#include <functional>
+#include <map>
+#include <vector>
+#include "Udp.h"
+#include "ESP8266WiFi.h"
+
+namespace sim
+{
+    struct Datagram
+    {
+        IPAddress address; // Of the other end
+        uint16_t port;
+        std::vector<uint8_t> data;
+    };
+
+    /// Hosts reachable over WiFi, by address: each receives the datagrams sent to it
+    inline std::map<uint32_t, std::function<void(const Datagram &datagram)>> udpHosts;
+
+    /// Datagrams on their way to the sketch, by the millis() they arrive at
+    inline std::multimap<unsigned long, Datagram> udpArrivals;
+
+    inline void UdpReply(unsigned long at, const Datagram &datagram) { udpArrivals.emplace(at, datagram); }
+}
+
+/**
+ * UDP socket over the simulated network: packets reach the sim::udpHosts while WiFi is
+ * connected, and replies are read once their arrival time has come.
+ */
+class WiFiUDP : public UDP
+{
+public:
+    uint8_t begin(uint16_t port) override
+    {
+        _port = port;
+        return 1;
+    }
+
+    void stop() override { _port = 0; }
+
+    int beginPacket(IPAddress ip, uint16_t port) override
+    {
+        _out = {ip, port, {}};
+        return 1;
+    }
+
+    // Resolves the name first, blocking like the core
+    int beginPacket(const char *host, uint16_t port) override
+    {
+        IPAddress address;
+        return WiFi.hostByName(host, address) ? beginPacket(address, port) : 0;
+    }
+
+    int endPacket() override
+    {
+        if (!_port || WiFi.status() != WL_CONNECTED)
+            return 0;
+        auto host = sim::udpHosts.find((uint32_t)_out.address);
+        if (host != sim::udpHosts.end())
+            host->second(_out);
+        return 1;
+    }
+
+    size_t write(uint8_t byte) override { return write(&byte, 1); }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        _out.data.insert(_out.data.end(), buffer, buffer + size);
+        return size;
+    }
+
+    int parsePacket() override
+    {
+        _in.clear();
+        auto arrival = sim::udpArrivals.begin();
+        if (!_port || arrival == sim::udpArrivals.end() || arrival->first > millis())
+            return 0;
+
+        _from = arrival->second;
+        _in.assign(_from.data.begin(), _from.data.end());
+        sim::udpArrivals.erase(arrival);
+        return _in.size();
+    }
+
+    int available() override { return _in.size(); }
+
+    int read() override
+    {
+        if (_in.empty())
+            return -1;
+        uint8_t byte = _in.front();
+        _in.pop_front();
+        return byte;
+    }
+
+    int read(unsigned char *buffer, size_t size) override
+    {
+        size_t count = size < _in.size() ? size : _in.size();
+        for (size_t i = 0; i < count; i++)
+        {
+            buffer[i] = _in.front();
+            _in.pop_front();
+        }
+        return count;
+    }
+
+    IPAddress remoteIP() override { return _from.address; }
+    uint16_t remotePort() override { return _from.port; }
+
+private:
+    uint16_t _port = 0;
+    sim::Datagram _out;
+    sim::Datagram _from;
+    std::deque<uint8_t> _in;
+};
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef COREDECLS_H
+#define COREDECLS_H
+
+#include <stdint.h>
+#include <Arduino.h>
+
+// Resumes the loop suspended in esp_delay(): the blocked condition is checked again
+inline void esp_schedule() {}
+
+inline void esp_delay(const uint32_t timeout_ms) { sim::Advance(timeout_ms); }
+
+/**
+ * Like core 3.x: sleeps up to timeout_ms while blocked() holds, checked again whenever
+ * the loop is resumed, here after each interrupt or callback.
+ */
+template <typename T>
+inline void esp_delay(const uint32_t timeout_ms, T &&blocked)
+{
+    sim::AdvanceUntil(millis() + timeout_ms, [&]() { return !blocked(); });
+}
+
+#endif
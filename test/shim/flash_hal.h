@@ -0,0 +1,15 @@
+#ifndef FLASH_HAL_H
+#define FLASH_HAL_H
+
+#include <stdint.h>
+
+namespace sim
+{
+    // Filesystem partition of a 4 MB board with 2 MB of FS, sized by the tests
+    inline uint32_t fsSize = 0x1FA000;
+}
+
+#define FS_PHYS_ADDR 0x200000
+#define FS_PHYS_SIZE (sim::fsSize)
+
+#endif
@@ -0,0 +1,7 @@
+#ifndef LWIP_DNS_H
+#define LWIP_DNS_H
+
+// dns_gethostbyname() is simulated along with WiFi, whose connection it needs
+#include <ESP8266WiFi.h>
+
+#endif
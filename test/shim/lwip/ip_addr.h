@@ -0,0 +1,12 @@
+#ifndef LWIP_IP_ADDR_H
+#define LWIP_IP_ADDR_H
+
+#include <stdint.h>
+
+// IPv4 only, as the ESP8266 core builds lwIP
+typedef struct ip_addr
+{
+    uint32_t addr; // Network byte order
+} ip_addr_t;
+
+#endif
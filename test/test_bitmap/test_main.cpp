@@ -0,0 +1,143 @@
+/**
+ * BitmapSchedule against LampSchedule on the same configurations: a minute of the bitmap
+ * is on if the exact plan is on at any second of it, and the transitions are those of
+ * the exact plan rounded to the minute.
+ */
+#include <unity.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "BitmapSchedule.hpp"
+
+static EspFlashStorage storage(0, 2);
+static PersistentConfiguration configuration(&storage);
+
+static TimerInterval interval(TimeType onType, long on, TimeType offType, long off)
+{
+    TimerInterval ti = {};
+    ti.on.tm_hour = on / 3600;
+    ti.on.tm_min = on / 60 % 60;
+    ti.on.tm_sec = on % 60;
+    ti.onType = onType;
+    ti.off.tm_hour = off / 3600;
+    ti.off.tm_min = off / 60 % 60;
+    ti.off.tm_sec = off % 60;
+    ti.offType = offType;
+    return ti;
+}
+
+static TimerInterval exact(long on, long off) { return interval(EXACT, on, EXACT, off); }
+
+// Off before on: never matches
+static TimerInterval never() { return exact(12 * 3600, 11 * 3600); }
+
+static const SunTimes SUN_TIMES = {days_from_civil(2024, 3, 20), time_from_civil(2024, 3, 20, 6, 12, 31), time_from_civil(2024, 3, 20, 18, 27, 5),
+                                   time_from_civil(2024, 3, 20, 7, 40, 59), time_from_civil(2024, 3, 20, 17, 3, 0)};
+
+void setUp() {}
+void tearDown() {}
+
+static void configure(const std::vector<TimerInterval> &intervals)
+{
+    for (int i = 0; i < NUM_INTERVALS; i++)
+        configuration.SetTimerInterval(i, i < (int)intervals.size() ? intervals[i] : never());
+}
+
+// The bitmap against the exact plan, minute by minute
+static void check(const SunTimes &sunTimes)
+{
+    LampSchedule exact;
+    BitmapSchedule bitmap;
+    exact.Compile(&configuration, sunTimes);
+    bitmap.Compile(&configuration, sunTimes);
+
+    ChannelMask minutes[MINUTES_PER_DAY] = {0};
+    for (long second = 0; second < SECONDS_PER_DAY; second++)
+        minutes[second / 60] |= exact.GetState(second);
+
+    for (long second = 0; second < SECONDS_PER_DAY; second++)
+    {
+        int minute = second / 60;
+        TEST_ASSERT_EQUAL(minutes[minute], bitmap.GetState(second));
+
+        // The next minute that differs from this one
+        int next = minute + 1;
+        while (next < MINUTES_PER_DAY && minutes[next] == minutes[minute])
+            next++;
+        TEST_ASSERT_EQUAL(next * 60L, bitmap.NextTransition(second));
+
+        // An exact transition within the minute before or after it
+        if (next < MINUTES_PER_DAY)
+            TEST_ASSERT_LESS_OR_EQUAL(next * 60L + 59, exact.NextTransition(next * 60L - 61));
+    }
+}
+
+void test_edges_of_the_day()
+{
+    configure({exact(0, 59), exact(23 * 3600 + 59 * 60, 0)});
+    check(SUN_TIMES);
+
+    // off == 23:59, and off at midnight (the end of the day)
+    configure({exact(20 * 3600, 23 * 3600 + 59 * 60), exact(22 * 3600 + 30, 0)});
+    check(SUN_TIMES);
+
+    configure({exact(0, 23 * 3600 + 59 * 60 + 59)});
+    check(SUN_TIMES);
+}
+
+// Across midnight an interval ends before it starts, so it never matches in either engine;
+// it takes one interval to midnight and one from it
+void test_midnight_spanning()
+{
+    configure({exact(22 * 3600, 2 * 3600)});
+    check(SUN_TIMES);
+
+    configure({exact(22 * 3600, 0), exact(0, 2 * 3600 + 15)});
+    check(SUN_TIMES);
+}
+
+// Ranges starting and ending on and around the 32-minute words of the bitmap
+void test_word_boundaries()
+{
+    for (long minute : {31L, 32L, 63L, 64L, 1407L, 1408L, 1439L})
+    {
+        configure({exact(minute * 60, minute * 60 + 59), exact((minute - 31) * 60 + 59, (minute - 1) * 60),
+                   exact(minute * 60 + 1, minute * 60 + 1)});
+        check(SUN_TIMES);
+    }
+}
+
+void test_sun_times()
+{
+    configure({interval(SUNSET, 0, EXACT, 0), interval(EXACT, 0, SUNRISE, 0),
+               interval(IRRADIANCE, 0, EXACT, 23 * 3600 + 59 * 60), interval(EXACT, 5 * 3600, IRRADIANCE, 0)});
+    check(SUN_TIMES);
+}
+
+void test_random_configurations()
+{
+    std::mt19937 random(11);
+    std::uniform_int_distribution<long> second(0, SECONDS_PER_DAY - 1);
+    for (int i = 0; i < 200; i++)
+    {
+        std::vector<TimerInterval> intervals;
+        for (int j = 0; j < NUM_INTERVALS; j++)
+        {
+            long on = second(random), off = second(random);
+            intervals.push_back(exact(std::min(on, off), std::max(on, off)));
+        }
+        configure(intervals);
+        check(SUN_TIMES);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_edges_of_the_day);
+    RUN_TEST(test_midnight_spanning);
+    RUN_TEST(test_word_boundaries);
+    RUN_TEST(test_sun_times);
+    RUN_TEST(test_random_configurations);
+    return UNITY_END();
+}
@@ -0,0 +1,141 @@
+/**
+ * The firmware built with three channels: overlapping intervals on different channel
+ * masks give one state word per transition, a channel stays on while any of its
+ * intervals is, and the relays written are only those whose channel changed.
+ */
+#define NUM_CHANNELS 3
+#define LAMP_PINS {D1, D2, D5}
+
+#include <unity.h>
+#include <utility>
+#include <vector>
+#include "HelloServer.ino"
+
+static std::vector<std::pair<uint8_t, uint8_t>> writes; // Pin and value of each digitalWrite
+
+void setUp()
+{
+    writes.clear();
+    sim::onDigitalWrite = [](uint8_t pin, uint8_t value) { writes.push_back({pin, value}); };
+}
+
+void tearDown()
+{
+    sim::onDigitalWrite = nullptr;
+}
+
+static TimerInterval interval(int onHour, int offHour, ChannelMask channels)
+{
+    TimerInterval ti = {};
+    ti.on.tm_hour = onHour;
+    ti.off.tm_hour = offHour;
+    ti.channels = channels;
+    return ti;
+}
+
+static SunTimes day_of(int year, int month, int day)
+{
+    long days = days_from_civil(year, month, day);
+    return {days, days * SECONDS_PER_DAY + 6 * 3600, days * SECONDS_PER_DAY + 18 * 3600,
+            days * SECONDS_PER_DAY + 7 * 3600, days * SECONDS_PER_DAY + 17 * 3600};
+}
+
+// Channel 1 from 8 to 12, channels 1-2 from 10 to 14, channels 2-3 from 11 to 13, and a
+// mask of a channel this build does not have from 16 to 17
+static void configure()
+{
+    persistentConfiguration.SetTimerInterval(0, interval(8, 12, 0b001));
+    persistentConfiguration.SetTimerInterval(1, interval(10, 14, 0b011));
+    persistentConfiguration.SetTimerInterval(2, interval(11, 13, 0b110));
+    persistentConfiguration.SetTimerInterval(3, interval(16, 17, 0b1000));
+}
+
+void test_interval_channels()
+{
+    TEST_ASSERT_EQUAL(0b101, LampSchedule::IntervalChannels(interval(0, 1, 0b101)));
+    TEST_ASSERT_EQUAL(0b111, LampSchedule::IntervalChannels(interval(0, 1, 0xFFFF)));
+    TEST_ASSERT_EQUAL(0b010, LampSchedule::IntervalChannels(interval(0, 1, 0b1010)));
+    TEST_ASSERT_EQUAL(1, LampSchedule::IntervalChannels(interval(0, 1, 0b1000)));
+    TEST_ASSERT_EQUAL(1, LampSchedule::IntervalChannels(interval(0, 1, 0)));
+}
+
+// The off time is inclusive: an interval ends the second after it
+static const struct
+{
+    long second;
+    ChannelMask state;
+} TRANSITIONS[] = {{8 * 3600L, 0b001},        {10 * 3600L, 0b011},     {11 * 3600L, 0b111},
+                   {13 * 3600L + 1, 0b011},   {14 * 3600L + 1, 0b000}, {16 * 3600L, 0b001},
+                   {17 * 3600L + 1, 0b000}};
+
+void test_state_words()
+{
+    configure();
+    LampSchedule schedule;
+    schedule.Compile(&persistentConfiguration, day_of(2024, 5, 1));
+
+    long second = 0;
+    TEST_ASSERT_EQUAL(0, schedule.GetState(0));
+    for (const auto &transition : TRANSITIONS)
+    {
+        TEST_ASSERT_EQUAL(transition.second, schedule.NextTransition(second));
+        TEST_ASSERT_EQUAL(schedule.GetState(second), schedule.GetState(transition.second - 1));
+        second = transition.second;
+        TEST_ASSERT_EQUAL(transition.state, schedule.GetState(second));
+    }
+    TEST_ASSERT_EQUAL(SECONDS_PER_DAY, schedule.NextTransition(second));
+
+    // Channel 1 stays on when the first of its intervals ends within the second one
+    TEST_ASSERT_EQUAL(0b111, schedule.GetState(12 * 3600L + 1));
+}
+
+static void assert_writes(std::vector<std::pair<uint8_t, uint8_t>> expected)
+{
+    TEST_ASSERT_EQUAL(expected.size(), writes.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        TEST_ASSERT_EQUAL(expected[i].first, writes[i].first);
+        TEST_ASSERT_EQUAL(expected[i].second, writes[i].second);
+    }
+    writes.clear();
+}
+
+void test_set_lamp_states()
+{
+    eventLogger.Begin();
+
+    // The first time every relay is written, then only the changed ones
+    platformManager.SetLampStates(0);
+    assert_writes({{D1, LAMP_OFF}, {D2, LAMP_OFF}, {D5, LAMP_OFF}});
+
+    ChannelMask previous = 0;
+    for (const auto &transition : TRANSITIONS)
+    {
+        platformManager.SetLampStates(transition.state);
+        std::vector<std::pair<uint8_t, uint8_t>> expected;
+        for (int channel = 0; channel < NUM_CHANNELS; channel++)
+        {
+            if ((previous ^ transition.state) >> channel & 1)
+                expected.push_back({lampPins[channel], transition.state >> channel & 1 ? LAMP_ON : LAMP_OFF});
+        }
+        assert_writes(expected);
+        previous = transition.state;
+    }
+
+    // The same state again writes nothing
+    platformManager.SetLampStates(previous);
+    assert_writes({});
+    platformManager.SetLampStates(0b101);
+    assert_writes({{D1, LAMP_ON}, {D5, LAMP_ON}});
+    platformManager.SetLampStates(0b110);
+    assert_writes({{D1, LAMP_OFF}, {D2, LAMP_ON}});
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_interval_channels);
+    RUN_TEST(test_state_words);
+    RUN_TEST(test_set_lamp_states);
+    return UNITY_END();
+}
@@ -0,0 +1,86 @@
+/**
+ * CivilTime against the C library: every day of the unsigned 32-bit epoch range,
+ * 1970-01-01 to 2106-02-07, through gmtime_r and timegm.
+ */
+#include <unity.h>
+#include <cstdint>
+#include <ctime>
+#include "CivilTime.hpp"
+
+void setUp() {}
+void tearDown() {}
+
+static const long LAST_DAY = (long)(UINT32_MAX / SECONDS_PER_DAY);
+
+// Usable at compile time, as the plan code relies on
+static_assert(days_from_civil(1970, 1, 1) == 0, "epoch");
+static_assert(days_from_civil(2000, 3, 1) == 11017, "leap day of a 400 year");
+static_assert(civil_from_days(LAST_DAY).year == 2106, "last day");
+static_assert(weekday(0) == 4, "1970-01-01 was a Thursday");
+
+static void assert_same_tm(const std::tm &expected, const std::tm &actual, time_t t)
+{
+    char message[64];
+    snprintf(message, sizeof(message), "time %lld", (long long)t);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_year, actual.tm_year, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_mon, actual.tm_mon, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_mday, actual.tm_mday, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_hour, actual.tm_hour, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_min, actual.tm_min, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_sec, actual.tm_sec, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_wday, actual.tm_wday, message);
+    TEST_ASSERT_EQUAL_MESSAGE(expected.tm_yday, actual.tm_yday, message);
+}
+
+void test_every_day()
+{
+    for (long day = 0; day <= LAST_DAY; day++)
+    {
+        // A different second of the day each time, the last second included
+        time_t t = (time_t)day * SECONDS_PER_DAY + (day * 7919) % SECONDS_PER_DAY;
+        if (day == LAST_DAY)
+            t = UINT32_MAX;
+
+        std::tm expected, actual;
+        gmtime_r(&t, &expected);
+        civil_time(t, actual);
+        assert_same_tm(expected, actual, t);
+
+        CivilDate date = civil_from_days(day);
+        TEST_ASSERT_EQUAL(day, days_from_civil(date.year, date.month, date.day));
+        TEST_ASSERT_EQUAL(day, days_from_time(t));
+        TEST_ASSERT_EQUAL(t - (time_t)day * SECONDS_PER_DAY, seconds_of_day(t));
+        TEST_ASSERT_EQUAL(is_leap_year(date.year) ? 366 : 365,
+                          days_from_civil(date.year + 1, 1, 1) - days_from_civil(date.year, 1, 1));
+        TEST_ASSERT_EQUAL(timegm(&expected),
+                          time_from_civil(date.year, date.month, date.day, expected.tm_hour, expected.tm_min, expected.tm_sec));
+    }
+}
+
+// Every second across the day boundaries of leap days and year ends
+void test_every_second_around_boundaries()
+{
+    const time_t boundaries[] = {
+        time_from_civil(1972, 2, 29), time_from_civil(1972, 3, 1), time_from_civil(2000, 2, 29),
+        time_from_civil(2000, 3, 1), time_from_civil(2038, 1, 19), time_from_civil(2100, 3, 1),
+        time_from_civil(2105, 12, 31), time_from_civil(2106, 1, 1)};
+
+    for (time_t boundary : boundaries)
+    {
+        for (time_t t = boundary - SECONDS_PER_DAY; t < boundary + SECONDS_PER_DAY; t++)
+        {
+            std::tm expected, actual;
+            gmtime_r(&t, &expected);
+            civil_time(t, actual);
+            assert_same_tm(expected, actual, t);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_every_day);
+    RUN_TEST(test_every_second_around_boundaries);
+    return UNITY_END();
+}
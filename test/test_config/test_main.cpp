@@ -0,0 +1,323 @@
+/**
+ * PersistentConfiguration across restarts: the EEPROM layout of the firmware before the
+ * A/B slots is migrated, a save torn at any byte leaves the previous or the new
+ * configuration, and without the filesystem partition the configuration is kept in EEPROM.
+ */
+#include <unity.h>
+#include <memory>
+#include <vector>
+#include "PersistentConfiguration.hpp"
+
+static const uint32_t SECTORS = 2;
+
+// NOR flash in RAM, the power is cut after budget bytes
+class RamFlash : public FlashStorage
+{
+public:
+    std::vector<uint8_t> bytes;
+    long budget = -1;
+
+    RamFlash() : bytes(SECTORS * FLASH_SECTOR_SIZE, 0xFF) {}
+
+    uint32_t Sectors() override { return SECTORS; }
+
+    bool Read(uint32_t address, uint32_t *data, size_t size) override
+    {
+        if (address + size > bytes.size())
+            return false;
+        memcpy(data, bytes.data() + address, size);
+        return true;
+    }
+
+    bool Write(uint32_t address, const uint32_t *data, size_t size) override
+    {
+        if (address + size > bytes.size())
+            return false;
+        for (size_t i = 0; i < size; i++)
+        {
+            if (budget == 0)
+                return false;
+            if (budget > 0)
+                budget--;
+            bytes[address + i] &= ((const uint8_t *)data)[i];
+        }
+        return true;
+    }
+
+    bool EraseSector(uint32_t sector) override
+    {
+        if (budget == 0 || sector >= SECTORS)
+            return false;
+        memset(bytes.data() + sector * FLASH_SECTOR_SIZE, 0xFF, FLASH_SECTOR_SIZE);
+        return true;
+    }
+};
+
+// What the firmware before the slots wrote with EEPROM.put
+struct BaselineInterval
+{
+    std::tm on;
+    TimeType onType;
+    std::tm off;
+    TimeType offType;
+};
+
+struct BaselineConf
+{
+    char ssid[32 + 1];
+    char password[64 + 1];
+    float latitude;
+    float longitude;
+    float tzOffset;
+    BaselineInterval timerIntervals[NUM_INTERVALS];
+};
+
+static TimerInterval make_interval(int i, int variant)
+{
+    TimerInterval ti = {};
+    ti.on.tm_hour = (18 + i + variant) % 24;
+    ti.on.tm_min = 5 * i;
+    ti.onType = (TimeType)((i + variant) % (IRRADIANCE + 1));
+    ti.off.tm_hour = (6 + i) % 24;
+    ti.off.tm_sec = variant;
+    ti.offType = (TimeType)(i % (IRRADIANCE + 1));
+    ti.channels = (1 << i) | variant;
+    ti.weekdays = 0x7F & ~(1 << i);
+    ti.skipFrom = 1201 + variant;
+    ti.skipTo = 105 + i;
+    return ti;
+}
+
+// A configuration per variant: 0 is small, 1 changes a few bytes, 2 nearly all of them
+static void configure(PersistentConfiguration &configuration, int variant)
+{
+    configuration.SetSSID(variant == 2 ? "AnotherNetworkWithALongerName" : "Home");
+    configuration.SetPassword(variant == 2 ? "a much longer passphrase for the other network" : "password");
+    configuration.SetCoordinates(44.39f + variant, 7.55f);
+    configuration.SetTimezoneOffset(variant == 2 ? -5 : 1);
+    configuration.SetIrradianceThreshold(variant * 10.5f);
+    for (int i = 0; i < NUM_INTERVALS; i++)
+        configuration.SetTimerInterval(i, make_interval(i, variant));
+}
+
+static bool same_interval(const TimerInterval &a, const TimerInterval &b)
+{
+    return a.on.tm_hour == b.on.tm_hour && a.on.tm_min == b.on.tm_min && a.on.tm_sec == b.on.tm_sec &&
+           a.onType == b.onType && a.off.tm_hour == b.off.tm_hour && a.off.tm_min == b.off.tm_min &&
+           a.off.tm_sec == b.off.tm_sec && a.offType == b.offType && a.channels == b.channels &&
+           a.weekdays == b.weekdays && a.skipFrom == b.skipFrom && a.skipTo == b.skipTo;
+}
+
+static bool same(PersistentConfiguration &a, PersistentConfiguration &b)
+{
+    float latA, lngA, latB, lngB;
+    a.GetCoordinates(latA, lngA);
+    b.GetCoordinates(latB, lngB);
+    if (a.GetSSID() != b.GetSSID() || a.GetPassword() != b.GetPassword() || latA != latB || lngA != lngB ||
+        a.GetTimezoneOffset() != b.GetTimezoneOffset() || a.GetIrradianceThreshold() != b.GetIrradianceThreshold())
+        return false;
+    for (int i = 0; i < NUM_INTERVALS; i++)
+        if (!same_interval(a.GetTimerInterval(i), b.GetTimerInterval(i)))
+            return false;
+    return true;
+}
+
+void setUp()
+{
+    memset(sim::Eeprom(), 0xFF, sim::EEPROM_SIZE);
+    sim::eepromCommits = 0;
+    sim::flashErases.clear();
+    sim::fsSize = 0x1FA000;
+}
+
+void tearDown() {}
+
+static void write_baseline()
+{
+    BaselineConf baseline;
+    memset(&baseline, 0, sizeof(baseline));
+    strcpy(baseline.ssid, "Home");
+    strcpy(baseline.password, "password");
+    baseline.latitude = 44.39f;
+    baseline.longitude = 7.55f;
+    baseline.tzOffset = 1;
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        baseline.timerIntervals[i].on.tm_hour = 18 + i;
+        baseline.timerIntervals[i].on.tm_min = 30;
+        baseline.timerIntervals[i].onType = i % 2 ? SUNSET : EXACT;
+        baseline.timerIntervals[i].off.tm_hour = 6;
+        baseline.timerIntervals[i].off.tm_sec = i;
+        baseline.timerIntervals[i].offType = i % 2 ? EXACT : SUNRISE;
+    }
+    EEPROM.begin(sizeof(BaselineConf));
+    EEPROM.put(0, baseline);
+    EEPROM.end();
+}
+
+static void assert_baseline(PersistentConfiguration &configuration)
+{
+    TEST_ASSERT_EQUAL_STRING("Home", configuration.GetSSID().c_str());
+    TEST_ASSERT_EQUAL_STRING("password", configuration.GetPassword().c_str());
+    float latitude, longitude;
+    configuration.GetCoordinates(latitude, longitude);
+    TEST_ASSERT_EQUAL_FLOAT(44.39f, latitude);
+    TEST_ASSERT_EQUAL_FLOAT(7.55f, longitude);
+    TEST_ASSERT_EQUAL_FLOAT(1, configuration.GetTimezoneOffset());
+    TEST_ASSERT_EQUAL_FLOAT(0, configuration.GetIrradianceThreshold());
+    for (int i = 0; i < NUM_INTERVALS; i++)
+    {
+        TimerInterval ti = configuration.GetTimerInterval(i);
+        TEST_ASSERT_EQUAL(18 + i, ti.on.tm_hour);
+        TEST_ASSERT_EQUAL(30, ti.on.tm_min);
+        TEST_ASSERT_EQUAL(i % 2 ? SUNSET : EXACT, ti.onType);
+        TEST_ASSERT_EQUAL(6, ti.off.tm_hour);
+        TEST_ASSERT_EQUAL(i, ti.off.tm_sec);
+        TEST_ASSERT_EQUAL(i % 2 ? EXACT : SUNRISE, ti.offType);
+        // The fields the baseline did not have get their defaults
+        TEST_ASSERT_EQUAL(0, ti.channels);
+        TEST_ASSERT_EQUAL(0, ti.weekdays);
+        TEST_ASSERT_EQUAL(0, ti.skipFrom);
+        TEST_ASSERT_EQUAL(0, ti.skipTo);
+    }
+}
+
+void test_migrates_the_baseline_layout()
+{
+    write_baseline();
+    RamFlash flash;
+    PersistentConfiguration migrated(&flash);
+    assert_baseline(migrated);
+
+    // Then it comes from the slots
+    memset(sim::Eeprom(), 0xFF, sim::EEPROM_SIZE);
+    PersistentConfiguration restarted(&flash);
+    assert_baseline(restarted);
+}
+
+void test_empty_eeprom_gives_defaults()
+{
+    RamFlash flash;
+    PersistentConfiguration configuration(&flash);
+    TEST_ASSERT_EQUAL_STRING("", configuration.GetSSID().c_str());
+    TEST_ASSERT_EQUAL_FLOAT(0, configuration.GetTimezoneOffset());
+    TEST_ASSERT_EQUAL(EXACT, configuration.GetTimerInterval(0).onType);
+}
+
+void test_saves_survive_restarts()
+{
+    RamFlash flash;
+    PersistentConfiguration expected(&flash);
+    // More saves than a slot holds deltas, so that the image moves between the slots
+    for (int save = 0; save < 200; save++)
+    {
+        configure(expected, save % 3);
+        expected.SetTimezoneOffset(save % 24);
+        expected.SaveConfiguration();
+
+        PersistentConfiguration restarted(&flash);
+        TEST_ASSERT_TRUE(same(expected, restarted));
+    }
+}
+
+// The power is cut at every byte of a small save (a delta) and of a big one (a new image):
+// after the restart the configuration is the previous one or the new one
+void test_torn_saves()
+{
+    for (int variant = 1; variant <= 2; variant++)
+    {
+        unsigned previous = 0, saved = 0;
+        for (long cut = 0; cut < 800; cut++)
+        {
+            RamFlash flash;
+            PersistentConfiguration before(&flash);
+            configure(before, 0);
+            before.SaveConfiguration();
+
+            flash.budget = cut;
+            PersistentConfiguration after(&flash);
+            configure(after, variant);
+            after.SaveConfiguration();
+            flash.budget = -1;
+
+            PersistentConfiguration restarted(&flash);
+            if (same(restarted, before))
+                previous++;
+            else if (same(restarted, after))
+                saved++;
+            else
+                TEST_FAIL_MESSAGE("Torn save mixed the configurations");
+
+            // And the next save works
+            configure(restarted, 2 - variant);
+            restarted.SaveConfiguration();
+            PersistentConfiguration again(&flash);
+            TEST_ASSERT_TRUE(same(restarted, again));
+        }
+        printf("Variant %d: %u cuts kept the previous configuration, %u the new one\n", variant, previous, saved);
+        TEST_ASSERT_GREATER_THAN(0, previous);
+        TEST_ASSERT_GREATER_THAN(0, saved);
+    }
+}
+
+// Without the filesystem partition there are no slots: the EEPROM sector keeps the image
+void test_eeprom_without_filesystem()
+{
+    sim::fsSize = 0;
+    EspFlashStorage storage(8, 2);
+    TEST_ASSERT_EQUAL(0, storage.Sectors());
+
+    write_baseline();
+    PersistentConfiguration migrated(&storage);
+    assert_baseline(migrated);
+    PersistentConfiguration restarted(&storage);
+    assert_baseline(restarted);
+
+    configure(restarted, 2);
+    restarted.SaveConfiguration();
+    unsigned long commits = sim::eepromCommits;
+    restarted.SaveConfiguration(); // Unchanged: not written again
+    TEST_ASSERT_EQUAL(commits, sim::eepromCommits);
+
+    PersistentConfiguration again(&storage);
+    TEST_ASSERT_TRUE(same(restarted, again));
+    TEST_ASSERT_TRUE(sim::flashErases.empty());
+
+    // A torn EEPROM sector is not taken for a configuration, nor for the baseline layout
+    sim::Eeprom()[40] ^= 0x01;
+    PersistentConfiguration damaged(&storage);
+    TEST_ASSERT_EQUAL_STRING("", damaged.GetSSID().c_str());
+    TEST_ASSERT_EQUAL_FLOAT(0, damaged.GetTimezoneOffset());
+}
+
+// With the partition back, the configuration kept in EEPROM moves to the slots
+void test_eeprom_to_slots()
+{
+    sim::fsSize = 0;
+    EspFlashStorage storage(8, 2);
+    PersistentConfiguration expected(&storage);
+    configure(expected, 1);
+    expected.SaveConfiguration();
+    TEST_ASSERT_TRUE(sim::flashErases.empty());
+
+    sim::fsSize = 0x1FA000;
+    PersistentConfiguration slots(&storage);
+    TEST_ASSERT_TRUE(same(expected, slots));
+    TEST_ASSERT_FALSE(sim::flashErases.empty());
+
+    memset(sim::Eeprom(), 0xFF, sim::EEPROM_SIZE);
+    PersistentConfiguration restarted(&storage);
+    TEST_ASSERT_TRUE(same(expected, restarted));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_migrates_the_baseline_layout);
+    RUN_TEST(test_empty_eeprom_gives_defaults);
+    RUN_TEST(test_saves_survive_restarts);
+    RUN_TEST(test_torn_saves);
+    RUN_TEST(test_eeprom_without_filesystem);
+    RUN_TEST(test_eeprom_to_slots);
+    return UNITY_END();
+}
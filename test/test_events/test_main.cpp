@@ -0,0 +1,149 @@
+/**
+ * The /events endpoint of the firmware on the simulator, paged by a poller that keeps
+ * its since cursor across restarts of the device: every event is served once, in order,
+ * whether the restart is clean or a power cut.
+ */
+#include <unity.h>
+#include <new>
+#include <vector>
+#include "HelloServer.ino"
+#include "NtpServer.h"
+
+static sim::NtpServer servers[] = {
+    {"0.pool.ntp.org", IPAddress(10, 0, 0, 1)},
+    {"1.pool.ntp.org", IPAddress(10, 0, 0, 2)},
+    {"2.pool.ntp.org", IPAddress(10, 0, 0, 3)},
+    {"time.nist.gov", IPAddress(10, 0, 0, 4)}};
+
+static String since;               // Cursor of the poller
+static std::vector<int> served;    // Markers received, in order
+
+void setUp() {}
+void tearDown() {}
+
+static void run(unsigned long ms)
+{
+    unsigned long end = sim::now + ms;
+    while (sim::now < end)
+        loop();
+}
+
+// Events told apart by their argument
+static void log_markers(int from, int to)
+{
+    for (int i = from; i < to; i++)
+        eventLogger.LogEvent(EVENT_WIFI_FAILED, i);
+}
+
+// Pages from the cursor until nothing is left
+static void poll(unsigned long limit)
+{
+    while (true)
+    {
+        std::map<String, String> args = {{"limit", String(limit)}};
+        if (since.length())
+            args["since"] = since;
+        ESP8266WebServer::Response page = webServer.Request("/events", args);
+        TEST_ASSERT_EQUAL(200, page.code);
+
+        size_t at = 0;
+        int marker;
+        while ((at = page.body.find("retrying in ", at)) != std::string::npos)
+        {
+            sscanf(page.body.c_str() + at, "retrying in %d s.", &marker);
+            served.push_back(marker);
+            at++;
+        }
+
+        String next = page.headers["X-Next-Since"];
+        if (next == since)
+            return;
+        since = next;
+    }
+}
+
+// The event log of a new boot, recovered from the journal; without a flush, as a power cut
+static void restart()
+{
+    eventJournal.~EventJournal();
+    new (&eventJournal) EventJournal(&journalStorage);
+    eventLogger.~EventLogger();
+    new (&eventLogger) EventLogger(&timeClient, &eventJournal);
+    eventLogger.Begin();
+}
+
+static void assert_served(std::vector<int> expected)
+{
+    TEST_ASSERT_EQUAL(expected.size(), served.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        TEST_ASSERT_EQUAL(expected[i], served[i]);
+    served.clear();
+}
+
+static std::vector<int> range(int from, int to)
+{
+    std::vector<int> markers;
+    for (int i = from; i < to; i++)
+        markers.push_back(i);
+    return markers;
+}
+
+void test_pages()
+{
+    sim::utcAtZero = time_from_civil(2024, 5, 1, 8, 0, 0) * 1000ULL;
+    persistentConfiguration.SetSSID(sim::apSsid.c_str());
+    persistentConfiguration.SetPassword(sim::apPassword.c_str());
+    persistentConfiguration.SaveConfiguration();
+    setup();
+    run(60000);
+    TEST_ASSERT_TRUE(wifiManager.IsConnected());
+
+    log_markers(0, 30);
+    poll(7);
+    assert_served(range(0, 30));
+
+    // Nothing new, nothing served
+    poll(7);
+    assert_served({});
+}
+
+void test_clean_restart()
+{
+    log_markers(30, 40);
+    eventLogger.Flush();
+    restart();
+    log_markers(40, 50);
+    poll(4);
+    assert_served(range(30, 50));
+}
+
+// The events served before the cut are kept, the ones logged after the last poll and
+// not written yet are lost, and the numbers of the lost ones are not taken for new events
+void test_power_cut()
+{
+    log_markers(50, 60);
+    poll(50);
+    assert_served(range(50, 60));
+    log_markers(60, 65);
+    restart();
+    log_markers(65, 70);
+    poll(3);
+    assert_served(range(65, 70));
+
+    // Served but only partially: the rest of the page is kept too
+    log_markers(70, 80);
+    ESP8266WebServer::Response page = webServer.Request("/events", {{"since", since}, {"limit", "4"}});
+    since = page.headers["X-Next-Since"];
+    restart();
+    poll(50);
+    assert_served(range(74, 80));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_pages);
+    RUN_TEST(test_clean_restart);
+    RUN_TEST(test_power_cut);
+    return UNITY_END();
+}
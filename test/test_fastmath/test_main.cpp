@@ -0,0 +1,139 @@
+/**
+ * FastMath against the standard library: worst-case error of every function, speed,
+ * and the resulting error of SunclockF sunrise/sunset against the double Sunclock.
+ *
+ * Timings are of the host CPU, which has an FPU: they show the relative cost of the
+ * backends, the speedup on the ESP8266 (software float) is larger.
+ */
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "FastMath.hpp"
+#include "SunClock.hpp"
+#include "CivilTime.hpp"
+
+void setUp() {}
+void tearDown() {}
+
+struct MathError
+{
+    double sin, cos, tan, asin, acos;
+};
+
+template <typename Math>
+static MathError measure_error()
+{
+    MathError e = {0, 0, 0, 0, 0};
+    for (double x = -50; x <= 50; x += 1e-4)
+    {
+        e.sin = std::fmax(e.sin, std::fabs(Math::sin(x) - std::sin(x)));
+        e.cos = std::fmax(e.cos, std::fabs(Math::cos(x) - std::cos(x)));
+    }
+    // Relative above 1, where tan grows without bound
+    for (double x = -1.5; x <= 1.5; x += 1e-5)
+        e.tan = std::fmax(e.tan, std::fabs(Math::tan(x) - std::tan(x)) / std::fmax(1, std::fabs(std::tan(x))));
+    for (double x = -1; x <= 1; x += 1e-6)
+    {
+        e.asin = std::fmax(e.asin, std::fabs(Math::asin(x) - std::asin(x)));
+        e.acos = std::fmax(e.acos, std::fabs(Math::acos(x) - std::acos(x)));
+    }
+    return e;
+}
+
+// The bounds documented in FastMath.hpp
+void test_precision_1_error()
+{
+    MathError e = measure_error<FastMath<double, 1> >();
+    printf("Precision 1: sin %.3g cos %.3g tan %.3g asin %.3g acos %.3g\n", e.sin, e.cos, e.tan, e.asin, e.acos);
+    TEST_ASSERT_LESS_OR_EQUAL(1.3e-5, e.sin);
+    TEST_ASSERT_LESS_OR_EQUAL(1.3e-5, e.cos);
+    TEST_ASSERT_LESS_OR_EQUAL(1.7e-5, e.tan);
+    TEST_ASSERT_LESS_OR_EQUAL(6.8e-5, e.asin);
+    TEST_ASSERT_LESS_OR_EQUAL(6.8e-5, e.acos);
+}
+
+void test_precision_2_error()
+{
+    MathError e = measure_error<FastMath<double, 2> >();
+    printf("Precision 2: sin %.3g cos %.3g tan %.3g asin %.3g acos %.3g\n", e.sin, e.cos, e.tan, e.asin, e.acos);
+    TEST_ASSERT_LESS_OR_EQUAL(1.1e-7, e.sin);
+    TEST_ASSERT_LESS_OR_EQUAL(1.1e-7, e.cos);
+    TEST_ASSERT_LESS_OR_EQUAL(1.3e-7, e.tan);
+    TEST_ASSERT_LESS_OR_EQUAL(2.2e-8, e.asin);
+    TEST_ASSERT_LESS_OR_EQUAL(2.2e-8, e.acos);
+}
+
+template <typename Math>
+static double ns_per_call()
+{
+    const int n = 1000000;
+    volatile float sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+    {
+        float x = (float)(i % 6283) * 0.001f - 3.1415f;
+        sink = sink + Math::sin(x) + Math::cos(x) + Math::acos(x * 0.3f);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / n;
+}
+
+void test_speed()
+{
+    double std = ns_per_call<StdMath<float> >();
+    double p1 = ns_per_call<FastMath<float, 1> >();
+    double p2 = ns_per_call<FastMath<float, 2> >();
+    printf("sin+cos+acos, float: std %.1f ns, Precision 1 %.1f ns (x%.2f), Precision 2 %.1f ns (x%.2f)\n",
+           std, p1, std / p1, p2, std / p2);
+}
+
+template <typename Clock>
+static double max_rise_set_error(double min_latitude, double max_latitude)
+{
+    long first = days_from_civil(2000, 1, 1), last = days_from_civil(2100, 1, 1);
+    double worst = 0;
+    for (double lat = min_latitude; lat <= max_latitude; lat += 1)
+    {
+        for (double lng = -180; lng < 180; lng += 90)
+        {
+            Sunclock reference(lat, lng);
+            Clock clock((float)lat, (float)lng);
+            for (long day = first; day < last; day += 13)
+            {
+                time_t date = (time_t)day * 86400 + 43200;
+                worst = std::fmax(worst, std::fabs((double)(clock.sunrise(date) - reference.sunrise(date))));
+                worst = std::fmax(worst, std::fabs((double)(clock.sunset(date) - reference.sunset(date))));
+            }
+        }
+    }
+    return worst;
+}
+
+template <typename Clock>
+static double report_rise_set_error(const char *name)
+{
+    double error = max_rise_set_error<Clock>(-60, 60);
+    // Near the polar circle single precision dominates, whatever the backend
+    double fringe = std::fmax(max_rise_set_error<Clock>(-65, -61), max_rise_set_error<Clock>(61, 65));
+    printf("Sunrise/sunset error, %s: %.0f s within 60 deg, %.0f s at 61..65 deg\n", name, error, fringe);
+    return error;
+}
+
+// Seconds of difference from the double reference, years 2000-2100
+void test_sunrise_sunset_error()
+{
+    TEST_ASSERT_LESS_OR_EQUAL(2, report_rise_set_error<BasicSunclock<float> >("std"));
+    TEST_ASSERT_LESS_OR_EQUAL(5, (report_rise_set_error<BasicSunclock<float, FastMath<float, 1> > >("Precision 1")));
+    TEST_ASSERT_LESS_OR_EQUAL(2, (report_rise_set_error<BasicSunclock<float, FastMath<float, 2> > >("Precision 2")));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_precision_1_error);
+    RUN_TEST(test_precision_2_error);
+    RUN_TEST(test_speed);
+    RUN_TEST(test_sunrise_sunset_error);
+    return UNITY_END();
+}
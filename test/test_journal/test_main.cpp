@@ -0,0 +1,231 @@
+/**
+ * EventJournal on a RAM flash that behaves like NOR (writes only clear bits) and can lose
+ * power in the middle of a write: records survive restarts, torn writes lose at most the
+ * records being written, and the sectors wear evenly.
+ */
+#include <unity.h>
+#include <memory>
+#include <vector>
+#include "EventJournal.hpp"
+
+static const uint32_t SECTORS = 4;
+
+class RamFlash : public FlashStorage
+{
+public:
+    std::vector<uint8_t> bytes;
+    std::vector<unsigned> erases;
+    long budget = -1;       // Bytes written before the power is cut, -1 for no cut
+    long eraseBudget = -1;  // Budget set by the next erase, to cut the power after it
+
+    RamFlash() : bytes(SECTORS * FLASH_SECTOR_SIZE, 0xFF), erases(SECTORS) {}
+
+    uint32_t Sectors() override { return SECTORS; }
+
+    bool Read(uint32_t address, uint32_t *data, size_t size) override
+    {
+        if (address % 4 || size % 4 || address + size > bytes.size())
+            return false;
+        memcpy(data, bytes.data() + address, size);
+        return true;
+    }
+
+    bool Write(uint32_t address, const uint32_t *data, size_t size) override
+    {
+        if (address % 4 || size % 4 || address + size > bytes.size())
+            return false;
+        for (size_t i = 0; i < size; i++)
+        {
+            if (budget == 0)
+                return false;
+            if (budget > 0)
+                budget--;
+            bytes[address + i] &= ((const uint8_t *)data)[i];
+        }
+        return true;
+    }
+
+    bool EraseSector(uint32_t sector) override
+    {
+        if (budget == 0 || sector >= SECTORS)
+            return false;
+        memset(bytes.data() + sector * FLASH_SECTOR_SIZE, 0xFF, FLASH_SECTOR_SIZE);
+        erases[sector]++;
+        if (eraseBudget >= 0)
+        {
+            budget = eraseBudget;
+            eraseBudget = -1;
+        }
+        return true;
+    }
+};
+
+static std::vector<EventRecord> replayed;
+
+static void collect(const EventRecord &record, void *context) { replayed.push_back(record); }
+
+// A restart: a new journal recovers what is in flash
+static std::unique_ptr<EventJournal> restart(RamFlash &flash)
+{
+    flash.budget = -1;
+    flash.eraseBudget = -1;
+    replayed.clear();
+    std::unique_ptr<EventJournal> journal(new EventJournal(&flash));
+    journal->Begin(collect, nullptr);
+    return journal;
+}
+
+static EventRecord make_record(uint32_t i)
+{
+    // Time mostly forward, at times back as after an NTP sync, and arguments of every size
+    uint32_t epoch = 1700000000 + i * 37 - (i % 50 == 0 ? 3600 : 0);
+    return {epoch, (EventCode)(i % NUM_EVENT_CODES), 0, (uint16_t)(i % 7 == 0 ? UINT16_MAX : i % 300)};
+}
+
+static void assert_records(uint32_t first, uint32_t count)
+{
+    TEST_ASSERT_EQUAL(count, replayed.size());
+    for (uint32_t i = 0; i < count; i++)
+    {
+        EventRecord expected = make_record(first + i);
+        TEST_ASSERT_EQUAL(expected.epoch, replayed[i].epoch);
+        TEST_ASSERT_EQUAL(expected.code, replayed[i].code);
+        TEST_ASSERT_EQUAL(expected.argument, replayed[i].argument);
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_records_survive_restart()
+{
+    RamFlash flash;
+    std::unique_ptr<EventJournal> journal = restart(flash);
+    for (uint32_t i = 0; i < 500; i++)
+        journal->Append(make_record(i));
+    journal->Flush();
+
+    journal = restart(flash);
+    assert_records(0, 500);
+
+    // Appends continue after the recovered records
+    for (uint32_t i = 500; i < 600; i++)
+        journal->Append(make_record(i));
+    journal->Flush();
+    journal = restart(flash);
+    assert_records(0, 600);
+    TEST_ASSERT_EQUAL(600, journal->Records());
+}
+
+// Records not flushed yet are lost with the power, the others are kept
+void test_unflushed_records()
+{
+    RamFlash flash;
+    std::unique_ptr<EventJournal> journal = restart(flash);
+    for (uint32_t i = 0; i < 10; i++)
+        journal->Append(make_record(i));
+    journal->Flush();
+    journal->Append(make_record(10));
+
+    journal = restart(flash);
+    assert_records(0, 10);
+}
+
+// Past the capacity the oldest sector goes, the recovered records are the latest in order
+void test_wrap_around_and_wear()
+{
+    RamFlash flash;
+    std::unique_ptr<EventJournal> journal = restart(flash);
+    const uint32_t total = 20000;
+    for (uint32_t i = 0; i < total; i++)
+        journal->Append(make_record(i));
+    journal->Flush();
+
+    journal = restart(flash);
+    TEST_ASSERT_GREATER_THAN(0, replayed.size());
+    assert_records(total - replayed.size(), replayed.size());
+    // Numbers carry on from the first record, not from the oldest one kept
+    TEST_ASSERT_EQUAL(total, journal->Records());
+
+    unsigned least = flash.erases[0], most = flash.erases[0];
+    for (unsigned erases : flash.erases)
+    {
+        least = std::min(least, erases);
+        most = std::max(most, erases);
+    }
+    printf("%u records, %u recovered, erases per sector %u..%u\n", total, (unsigned)replayed.size(), least, most);
+    TEST_ASSERT_LESS_OR_EQUAL(1, most - least);
+}
+
+// The power is cut at every byte of a page write: the journal recovers the records written
+// before it, and goes on appending after them
+void test_power_cut_at_every_byte()
+{
+    for (long cut = 0; cut <= (long)EventJournal::FLASH_PAGE_SIZE; cut++)
+    {
+        RamFlash flash;
+        std::unique_ptr<EventJournal> journal = restart(flash);
+        for (uint32_t i = 0; i < 40; i++)
+            journal->Append(make_record(i));
+        journal->Flush();
+
+        flash.budget = cut;
+        for (uint32_t i = 40; i < 80; i++)
+        {
+            journal->Append(make_record(i));
+            journal->Flush();
+        }
+
+        journal = restart(flash);
+        TEST_ASSERT_GREATER_OR_EQUAL(40, replayed.size());
+        uint32_t recovered = replayed.size();
+        assert_records(0, recovered);
+
+        journal->Append(make_record(recovered));
+        journal->Flush();
+        journal = restart(flash);
+        TEST_ASSERT_GREATER_OR_EQUAL(recovered, replayed.size());
+        for (uint32_t i = 0; i < recovered; i++)
+            TEST_ASSERT_EQUAL(make_record(i).epoch, replayed[i].epoch);
+        TEST_ASSERT_EQUAL(make_record(recovered).epoch, replayed.back().epoch);
+    }
+}
+
+// The power is cut at every byte of the first page of a new sector, header included: the
+// records of the previous sectors are kept
+void test_power_cut_starting_a_sector()
+{
+    for (long cut = 0; cut <= (long)EventJournal::FLASH_PAGE_SIZE; cut++)
+    {
+        RamFlash flash;
+        std::unique_ptr<EventJournal> journal = restart(flash);
+        uint32_t i = 0;
+        while (flash.erases[1] == 0)
+            journal->Append(make_record(i++));
+        journal->Flush();
+
+        // The record that starts the next sector is the first one lost
+        flash.eraseBudget = cut;
+        while (flash.erases[2] == 0)
+            journal->Append(make_record(i++));
+        uint32_t kept = i - 1;
+        for (int j = 0; j < 40; j++)
+            journal->Append(make_record(i++));
+        journal->Flush();
+
+        journal = restart(flash);
+        TEST_ASSERT_GREATER_OR_EQUAL(kept, replayed.size());
+        assert_records(0, replayed.size());
+    }
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_records_survive_restart);
+    RUN_TEST(test_unflushed_records);
+    RUN_TEST(test_wrap_around_and_wear);
+    RUN_TEST(test_power_cut_at_every_byte);
+    RUN_TEST(test_power_cut_starting_a_sector);
+    return UNITY_END();
+}
@@ -0,0 +1,153 @@
+/**
+ * Loop latency of the firmware on the simulator: the virtual time each scheduler pass
+ * takes, i.e. how long the lamps, the button and the web server can be kept waiting,
+ * stays under 10 ms through network failures, button presses and web requests.
+ * Setup mode is covered by test_wifi.
+ */
+#include <unity.h>
+#include <algorithm>
+#include "HelloServer.ino"
+#include "NtpServer.h"
+
+static const unsigned long MAX_LATENCY = 10; // ms
+
+static sim::NtpServer servers[] = {
+    {"0.pool.ntp.org", IPAddress(10, 0, 0, 1)},
+    {"1.pool.ntp.org", IPAddress(10, 0, 0, 2)},
+    {"2.pool.ntp.org", IPAddress(10, 0, 0, 3)},
+    {"time.nist.gov", IPAddress(10, 0, 0, 4)}};
+
+static unsigned long worst;
+static unsigned long passes;
+
+// loop() one step at a time, timing the scheduler pass. The last sleep is cut short at
+// the end, as an interrupt would, so that the scenarios follow each other on time.
+static void run(unsigned long ms)
+{
+    unsigned long end = sim::now + ms;
+    while (sim::now < end)
+    {
+        timeClient.takeSnapshot();
+        unsigned long start = sim::now;
+        scheduler.Run();
+        worst = std::max(worst, sim::now - start);
+        passes++;
+        esp_delay(std::min(scheduler.MillisToNextTask(), end - sim::now), []() { return !wakeRequested; });
+        wakeRequested = false;
+    }
+}
+
+static void press_button(unsigned long at) { sim::Interrupt(D3, at); }
+
+// ms the firmware clock is off true UTC
+static long clock_error()
+{
+    long offset = (long)(persistentConfiguration.GetTimezoneOffset() * 3600000);
+    return (long)(timeClient.getEpochMillis() - offset - sim::Utc());
+}
+
+void setUp()
+{
+    worst = 0;
+    passes = 0;
+}
+
+void tearDown() {}
+
+static void check_latency()
+{
+    printf("%lu passes, worst %lu ms\n", passes, worst);
+    TEST_ASSERT_LESS_OR_EQUAL(MAX_LATENCY, worst);
+}
+
+void test_boot_and_sync()
+{
+    sim::utcAtZero = time_from_civil(2024, 3, 20, 18, 0, 0) * 1000ULL;
+    persistentConfiguration.SetSSID(sim::apSsid.c_str());
+    persistentConfiguration.SetPassword(sim::apPassword.c_str());
+    persistentConfiguration.SaveConfiguration();
+    setup();
+    run(86400000UL);
+    TEST_ASSERT_INT_WITHIN(100, 0, clock_error());
+    check_latency();
+}
+
+void test_ntp_loss_and_jitter()
+{
+    for (sim::NtpServer &server : servers)
+    {
+        server.loss = 0.7;
+        server.jitter = 200;
+    }
+    servers[3].online = false;
+    run(3 * 86400000UL);
+    for (sim::NtpServer &server : servers)
+    {
+        server.loss = 0;
+        server.jitter = 0;
+        server.online = true;
+    }
+    check_latency();
+}
+
+// Past NTP_DNS_TTL every update waits for lookups that time out
+void test_name_server_down()
+{
+    unsigned long lookups = sim::lookups;
+    sim::dnsDown = true;
+    run(20 * 86400000UL);
+    sim::dnsDown = false;
+    TEST_ASSERT_GREATER_THAN(lookups, sim::lookups);
+    TEST_ASSERT_INT_WITHIN(100, 0, clock_error());
+    check_latency();
+}
+
+void test_access_point_gone()
+{
+    press_button(sim::now + 1000);
+    run(5000);
+    sim::apAvailable = false;
+    run(3600000UL);
+    sim::apAvailable = true;
+    run(3600000UL);
+    // An hour on the drift estimate, which the jittered replies of the loss scenario skewed
+    TEST_ASSERT_INT_WITHIN(250, 0, clock_error());
+    check_latency();
+}
+
+void test_button_presses()
+{
+    for (int i = 0; i < 100; i++)
+        press_button(sim::now + 1000 + i * 3000UL);
+    run(400000UL);
+    TEST_ASSERT_TRUE(wifiManager.IsWifiOn());
+    check_latency();
+}
+
+void test_web_requests()
+{
+    press_button(sim::now + 1000);
+    run(5000);
+    TEST_ASSERT_TRUE(wifiManager.IsConnected());
+    for (int i = 0; i < 50; i++)
+    {
+        unsigned long start = sim::now;
+        TEST_ASSERT_EQUAL(200, webServer.Request("/").code);
+        TEST_ASSERT_EQUAL(200, webServer.Request("/events", {{"since", String(i * 10)}, {"limit", "20"}}).code);
+        worst = std::max(worst, sim::now - start);
+        run(1000);
+    }
+    check_latency();
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_boot_and_sync);
+    RUN_TEST(test_ntp_loss_and_jitter);
+    RUN_TEST(test_name_server_down);
+    RUN_TEST(test_access_point_gone);
+    RUN_TEST(test_button_presses);
+    RUN_TEST(test_web_requests);
+    return UNITY_END();
+}
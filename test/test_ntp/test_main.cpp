@@ -0,0 +1,154 @@
+/**
+ * NTPClient over the simulated network against NTP server stand-ins: lookups and
+ * exchanges never block, and the clock keeps in sync through DNS failures and servers
+ * leaving the pool.
+ */
+#include <unity.h>
+#include <algorithm>
+#include <memory>
+#include "NTPClient.hpp"
+#include "NtpServer.h"
+#include <WiFiUdp.h>
+
+static const char *const NAMES[] = {"0.pool.ntp.org", "1.pool.ntp.org", "2.pool.ntp.org", "3.pool.ntp.org"};
+
+static std::unique_ptr<sim::NtpServer> servers[4];
+static WiFiUDP udp;
+static std::unique_ptr<NTPClient> timeClient;
+static unsigned long longestCall;
+
+void setUp()
+{
+    sim::now = 1000;
+    sim::events.clear();
+    sim::udpArrivals.clear();
+    sim::dnsRecords.clear();
+    sim::dnsDown = false;
+    sim::lookups = 0;
+    sim::blockingLookups = 0;
+    sim::utcAtZero = time_from_civil(2024, 6, 1) * 1000ULL;
+    sim::crystalError = 30e-6;
+    for (int i = 0; i < 4; i++)
+        servers[i].reset(new sim::NtpServer(NAMES[i], IPAddress(10, 0, 0, i + 1)));
+
+    WiFi.mode(WIFI_STA);
+    WiFi.begin(sim::apSsid.c_str(), sim::apPassword.c_str());
+    sim::Advance(sim::connectTime);
+
+    timeClient.reset(new NTPClient(udp));
+    timeClient->setPoolServerNames(NAMES, 4);
+    timeClient->setUpdateInterval(7 * 24 * 60 * 60 * 1000);
+    timeClient->begin();
+    longestCall = 0;
+}
+
+void tearDown()
+{
+    timeClient.reset();
+    for (std::unique_ptr<sim::NtpServer> &server : servers)
+        server.reset();
+}
+
+// update() until the exchange is over, as runTimeSync() does, timing each call
+static int exchange()
+{
+    int result;
+    do
+    {
+        sim::Advance(timeClient->getMillisToUpdate());
+        unsigned long start = sim::now;
+        result = timeClient->update();
+        longestCall = std::max(longestCall, sim::now - start);
+    } while (timeClient->isUpdating());
+    return result;
+}
+
+// ms the client clock is off true UTC
+static long clock_error() { return (long)(int64_t)(timeClient->getEpochMillis() - sim::Utc()); }
+
+void test_lookups_do_not_block()
+{
+    TEST_ASSERT_EQUAL(2, exchange());
+    TEST_ASSERT_EQUAL(4, sim::lookups);
+    TEST_ASSERT_EQUAL(0, sim::blockingLookups);
+    TEST_ASSERT_EQUAL(0, longestCall);
+    TEST_ASSERT_INT_WITHIN(5, 0, clock_error());
+    for (std::unique_ptr<sim::NtpServer> &server : servers)
+        TEST_ASSERT_EQUAL(1, server->requests);
+}
+
+// The update interval grows up to 7 days, the addresses outlast it
+void test_addresses_outlast_the_update_interval()
+{
+    unsigned long updates = 0;
+    while (sim::now < 30 * 86400000UL)
+    {
+        TEST_ASSERT_EQUAL(2, exchange());
+        TEST_ASSERT_INT_WITHIN(100, 0, clock_error());
+        updates++;
+    }
+    printf("%lu updates, %lu lookups in 30 days\n", updates, sim::lookups);
+    TEST_ASSERT_GREATER_THAN(4, updates);
+    TEST_ASSERT_LESS_OR_EQUAL(4 * (30 / 8 + 1), sim::lookups);
+    TEST_ASSERT_EQUAL(0, longestCall);
+}
+
+// With the name server down the expired addresses are still queried, after NTP_DNS_TIMEOUT
+void test_dns_down_keeps_stale_addresses()
+{
+    TEST_ASSERT_EQUAL(2, exchange());
+    sim::Advance(NTP_DNS_TTL);
+    sim::dnsDown = true;
+
+    unsigned long start = sim::now;
+    timeClient->forceUpdate();
+    TEST_ASSERT_EQUAL(2, exchange());
+    TEST_ASSERT_INT_WITHIN(200, NTP_DNS_TIMEOUT, sim::now - start);
+    TEST_ASSERT_EQUAL(0, longestCall);
+    TEST_ASSERT_EQUAL(0, sim::blockingLookups);
+    TEST_ASSERT_INT_WITHIN(5, 0, clock_error());
+    for (std::unique_ptr<sim::NtpServer> &server : servers)
+        TEST_ASSERT_EQUAL(2, server->requests);
+}
+
+// Without any address yet, nothing to query: the update fails without waiting for the name server
+void test_dns_down_at_boot()
+{
+    sim::dnsDown = true;
+    TEST_ASSERT_EQUAL(0, exchange());
+    TEST_ASSERT_EQUAL(0, longestCall);
+
+    sim::dnsDown = false;
+    sim::Advance(sim::dnsTimeout); // The failed lookups are over
+    timeClient->forceUpdate();
+    TEST_ASSERT_EQUAL(2, exchange());
+}
+
+// A server leaving the pool is looked up again at the next update, at its new address
+void test_retired_server_is_looked_up_again()
+{
+    TEST_ASSERT_EQUAL(2, exchange());
+    servers[2]->online = false;
+    sim::NtpServer moved(NAMES[2], IPAddress(10, 0, 1, 3));
+
+    timeClient->forceUpdate();
+    TEST_ASSERT_EQUAL(2, exchange());
+    TEST_ASSERT_EQUAL(0, moved.requests);
+    unsigned long lookups = sim::lookups;
+
+    timeClient->forceUpdate();
+    TEST_ASSERT_EQUAL(2, exchange());
+    TEST_ASSERT_EQUAL(lookups + 1, sim::lookups);
+    TEST_ASSERT_EQUAL(1, moved.replies);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_lookups_do_not_block);
+    RUN_TEST(test_addresses_outlast_the_update_interval);
+    RUN_TEST(test_dns_down_keeps_stale_addresses);
+    RUN_TEST(test_dns_down_at_boot);
+    RUN_TEST(test_retired_server_is_looked_up_again);
+    return UNITY_END();
+}
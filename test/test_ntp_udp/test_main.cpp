@@ -0,0 +1,282 @@
+/**
+ * NTPClient over real UDP sockets on the loopback, against a local NTP stand-in that
+ * injects delay and packet loss, in real time: millis() follows the steady clock and
+ * the time served is the system clock. No update() call waits on the network.
+ */
+#include <unity.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <thread>
+#include "NTPClient.hpp"
+
+using namespace std::chrono;
+
+/**
+ * NTP server on a loopback port, serving the system clock. Each request is lost with
+ * the given probability, otherwise it is answered with the given delay each way.
+ */
+class NtpStandIn
+{
+public:
+    std::atomic<int> delay{0}; // ms
+    std::atomic<double> loss{0};
+    std::atomic<unsigned> requests{0};
+
+    NtpStandIn()
+    {
+        _socket = socket(AF_INET, SOCK_DGRAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        bind(_socket, (sockaddr *)&address, sizeof(address));
+        socklen_t length = sizeof(address);
+        getsockname(_socket, (sockaddr *)&address, &length);
+        port = ntohs(address.sin_port);
+        timeval timeout = {0, 50000};
+        setsockopt(_socket, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        _thread = std::thread([this]() { Serve(); });
+    }
+
+    ~NtpStandIn()
+    {
+        _stop = true;
+        _thread.join();
+        close(_socket);
+    }
+
+    uint16_t port;
+
+private:
+    int _socket;
+    std::atomic<bool> _stop{false};
+    std::thread _thread;
+    std::mt19937 _random{17};
+
+    void Serve()
+    {
+        while (!_stop)
+        {
+            uint8_t packet[NTP_PACKET_SIZE];
+            sockaddr_in client;
+            socklen_t length = sizeof(client);
+            if (recvfrom(_socket, packet, sizeof(packet), 0, (sockaddr *)&client, &length) != NTP_PACKET_SIZE)
+                continue;
+            requests++;
+            if (std::uniform_real_distribution<double>(0, 1)(_random) < loss)
+                continue;
+
+            std::this_thread::sleep_for(milliseconds(delay));
+            uint8_t reply[NTP_PACKET_SIZE] = {0x24, 2};
+            memcpy(reply + 24, packet + 40, 8);
+            WriteTimestamp(reply + 32);
+            WriteTimestamp(reply + 40);
+            std::this_thread::sleep_for(milliseconds(delay));
+            sendto(_socket, reply, sizeof(reply), 0, (sockaddr *)&client, length);
+        }
+    }
+
+    static void WriteTimestamp(uint8_t *timestamp)
+    {
+        uint64_t utc = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+        uint32_t seconds = (uint32_t)(utc / 1000 + SEVENZYYEARS);
+        uint32_t fraction = (uint32_t)(((utc % 1000) << 32) / 1000);
+        for (int i = 0; i < 4; i++)
+        {
+            timestamp[i] = seconds >> (24 - 8 * i);
+            timestamp[4 + i] = fraction >> (24 - 8 * i);
+        }
+    }
+};
+
+/**
+ * UDP over a non-blocking socket. NTP port 123 needs privileges: datagrams to it go to
+ * the stand-in's port instead.
+ */
+class LinuxUDP : public UDP
+{
+public:
+    uint16_t ntpPort = 123;
+
+    uint8_t begin(uint16_t port) override
+    {
+        _socket = socket(AF_INET, SOCK_DGRAM, 0);
+        fcntl(_socket, F_SETFL, O_NONBLOCK);
+        return _socket >= 0;
+    }
+
+    void stop() override
+    {
+        close(_socket);
+        _socket = -1;
+    }
+
+    int beginPacket(IPAddress ip, uint16_t port) override
+    {
+        _to = {};
+        _to.sin_family = AF_INET;
+        _to.sin_addr.s_addr = (uint32_t)ip; // Both in network byte order
+        _to.sin_port = htons(port == 123 ? ntpPort : port);
+        _out.clear();
+        return 1;
+    }
+
+    int beginPacket(const char *host, uint16_t port) override { return 0; }
+
+    int endPacket() override
+    {
+        return sendto(_socket, _out.data(), _out.size(), 0, (sockaddr *)&_to, sizeof(_to)) == (ssize_t)_out.size();
+    }
+
+    size_t write(uint8_t byte) override { return write(&byte, 1); }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        _out.insert(_out.end(), buffer, buffer + size);
+        return size;
+    }
+
+    int parsePacket() override
+    {
+        uint8_t buffer[512];
+        socklen_t length = sizeof(_from);
+        ssize_t size = recvfrom(_socket, buffer, sizeof(buffer), 0, (sockaddr *)&_from, &length);
+        _in.assign(buffer, buffer + std::max<ssize_t>(size, 0));
+        _read = 0;
+        return _in.size();
+    }
+
+    int available() override { return _in.size() - _read; }
+    int read() override { return _read < _in.size() ? _in[_read++] : -1; }
+
+    int read(unsigned char *buffer, size_t size) override
+    {
+        size_t count = std::min(size, _in.size() - _read);
+        memcpy(buffer, _in.data() + _read, count);
+        _read += count;
+        return count;
+    }
+
+    IPAddress remoteIP() override { return IPAddress((uint32_t)_from.sin_addr.s_addr); }
+    uint16_t remotePort() override { return ntohs(_from.sin_port); }
+
+private:
+    int _socket = -1;
+    sockaddr_in _to = {}, _from = {};
+    std::vector<uint8_t> _out, _in;
+    size_t _read = 0;
+};
+
+static const steady_clock::time_point START = steady_clock::now();
+static NtpStandIn *server;
+static LinuxUDP udp;
+static NTPClient *timeClient;
+static long longestCall; // us
+
+// millis() follows the steady clock, from when the simulated WiFi is connected
+static void tick()
+{
+    sim::now = sim::connectTime + duration_cast<milliseconds>(steady_clock::now() - START).count();
+    sim::Service();
+}
+
+void setUp()
+{
+    tick();
+
+    server = new NtpStandIn();
+    udp.ntpPort = server->port;
+    timeClient = new NTPClient(udp, "ntp.local");
+    timeClient->begin();
+    longestCall = 0;
+}
+
+void tearDown()
+{
+    timeClient->end();
+    delete timeClient;
+    delete server;
+}
+
+// update() until the exchange is over, sleeping in between as the loop does
+static int exchange()
+{
+    int result;
+    do
+    {
+        std::this_thread::sleep_for(milliseconds(timeClient->getMillisToUpdate()));
+        tick();
+        steady_clock::time_point start = steady_clock::now();
+        result = timeClient->update();
+        longestCall = std::max(longestCall, (long)duration_cast<microseconds>(steady_clock::now() - start).count());
+    } while (timeClient->isUpdating());
+    return result;
+}
+
+// ms the client clock is off the system clock
+static long clock_error()
+{
+    tick();
+    int64_t utc = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+    return (long)((int64_t)timeClient->getEpochMillis() - utc);
+}
+
+void test_exchange()
+{
+    server->delay = 20;
+    TEST_ASSERT_EQUAL(2, exchange());
+    TEST_ASSERT_EQUAL(1, server->requests);
+    TEST_ASSERT_INT_WITHIN(10, 0, clock_error());
+    TEST_ASSERT_LESS_OR_EQUAL(5000, longestCall);
+}
+
+// Lost requests are sent again after NTP_TIMEOUT, up to NTP_MAX_ATTEMPTS
+void test_delay_and_loss()
+{
+    server->delay = 100;
+    server->loss = 0.5;
+    int synced = 0;
+    for (int i = 0; i < 6; i++)
+    {
+        timeClient->forceUpdate();
+        if (exchange() == 2)
+        {
+            synced++;
+            TEST_ASSERT_INT_WITHIN(20, 0, clock_error());
+        }
+    }
+    printf("%d of 6 updates synced with %u requests, longest update() %ld us\n", synced, (unsigned)server->requests, longestCall);
+    TEST_ASSERT_GREATER_THAN(6, server->requests);
+    TEST_ASSERT_GREATER_OR_EQUAL(4, synced);
+    TEST_ASSERT_LESS_OR_EQUAL(5000, longestCall);
+}
+
+void test_all_lost()
+{
+    server->loss = 1;
+    steady_clock::time_point start = steady_clock::now();
+    TEST_ASSERT_EQUAL(0, exchange());
+    long elapsed = duration_cast<milliseconds>(steady_clock::now() - start).count();
+    TEST_ASSERT_EQUAL(NTP_MAX_ATTEMPTS, server->requests);
+    TEST_ASSERT_INT_WITHIN(200, NTP_MAX_ATTEMPTS * NTP_TIMEOUT, elapsed);
+    TEST_ASSERT_LESS_OR_EQUAL(5000, longestCall);
+}
+
+int main(int argc, char **argv)
+{
+    WiFi.begin(sim::apSsid.c_str(), sim::apPassword.c_str());
+    sim::dnsRecords["ntp.local"] = IPAddress(127, 0, 0, 1);
+
+    UNITY_BEGIN();
+    RUN_TEST(test_exchange);
+    RUN_TEST(test_delay_and_loss);
+    RUN_TEST(test_all_lost);
+    return UNITY_END();
+}
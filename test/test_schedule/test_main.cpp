@@ -0,0 +1,217 @@
+/**
+ * LampSchedule against configurations compiled for specific days: the state of the
+ * lamps through the day for sun and irradiance times, from normal days to polar day
+ * and night, the weekdays and skipped dates of the intervals, and the plans kept by
+ * PlanCache across days and configuration changes.
+ */
+#include <unity.h>
+#include "LampSchedule.hpp"
+#include "PlanCache.hpp"
+#include "SunClock.hpp"
+
+static EspFlashStorage storage(0, 2);
+static PersistentConfiguration configuration(&storage);
+
+// An interval that never matches, off before on
+static TimerInterval never()
+{
+    TimerInterval ti = {};
+    ti.on.tm_hour = 12;
+    ti.off.tm_hour = 11;
+    return ti;
+}
+
+static TimerInterval interval(TimeType onType, int onHour, int onMinute, TimeType offType, int offHour, int offMinute)
+{
+    TimerInterval ti = {};
+    ti.on.tm_hour = onHour;
+    ti.on.tm_min = onMinute;
+    ti.onType = onType;
+    ti.off.tm_hour = offHour;
+    ti.off.tm_min = offMinute;
+    ti.offType = offType;
+    return ti;
+}
+
+static void configure(std::initializer_list<TimerInterval> intervals)
+{
+    int i = 0;
+    for (const TimerInterval &ti : intervals)
+        configuration.SetTimerInterval(i++, ti);
+    for (; i < NUM_INTERVALS; i++)
+        configuration.SetTimerInterval(i, never());
+}
+
+// Sun times of a local day, as setSunTimes() resolves them
+static SunTimes sun_times(double latitude, double longitude, double tzOffset, int year, int month, int day,
+                          double threshold)
+{
+    Sunclock sunclock(latitude, longitude, tzOffset);
+    SunDay sunDay;
+    sunclock.sun_days(time_from_civil(year, month, day, 12, 0, 0) - (time_t)(tzOffset * 3600), &sunDay, 1);
+    SunRiseSet crossings = sunclock.irradiance_crossings(sunDay, threshold);
+    return {days_from_civil(year, month, day), sunDay.rise, sunDay.set, crossings.rise, crossings.set};
+}
+
+// Every minute of the day in the given state
+static void assert_all_day(LampSchedule &schedule, ChannelMask state)
+{
+    for (long second = 0; second < SECONDS_PER_DAY; second += 60)
+        TEST_ASSERT_EQUAL(state, schedule.GetState(second));
+}
+
+void setUp() {}
+void tearDown() {}
+
+// On from the evening crossing to midnight, and from midnight to the morning crossing
+static void configure_irradiance()
+{
+    configure({interval(IRRADIANCE, 0, 0, EXACT, 0, 0), interval(EXACT, 0, 0, IRRADIANCE, 0, 0)});
+}
+
+void test_irradiance_normal_day()
+{
+    configure_irradiance();
+    SunTimes sunTimes = sun_times(44.39, 7.55, 1, 2024, 3, 20, 0.3);
+    LampSchedule schedule;
+    schedule.Compile(&configuration, sunTimes);
+
+    long rise = seconds_of_day(sunTimes.irradianceRise), set = seconds_of_day(sunTimes.irradianceSet);
+    TEST_ASSERT_EQUAL(1, schedule.GetState(0));
+    TEST_ASSERT_EQUAL(1, schedule.GetState(rise));
+    TEST_ASSERT_EQUAL(0, schedule.GetState(rise + 1));
+    TEST_ASSERT_EQUAL(0, schedule.GetState(12 * 3600));
+    TEST_ASSERT_EQUAL(0, schedule.GetState(set - 1));
+    TEST_ASSERT_EQUAL(1, schedule.GetState(set));
+    TEST_ASSERT_EQUAL(1, schedule.GetState(SECONDS_PER_DAY - 1));
+    TEST_ASSERT_EQUAL(rise + 1, schedule.NextTransition(0));
+    TEST_ASSERT_EQUAL(set, schedule.NextTransition(rise + 1));
+}
+
+// Bright all day: the lamp stays off
+void test_irradiance_always_above()
+{
+    configure_irradiance();
+    LampSchedule schedule;
+    schedule.Compile(&configuration, sun_times(69.65, 18.96, 2, 2024, 6, 21, 0));
+    assert_all_day(schedule, 0);
+    schedule.Compile(&configuration, sun_times(44.39, 7.55, 1, 2024, 3, 20, -0.5));
+    assert_all_day(schedule, 0);
+}
+
+// Dark all day: the lamp stays on
+void test_irradiance_never_reached()
+{
+    configure_irradiance();
+    LampSchedule schedule;
+    schedule.Compile(&configuration, sun_times(69.65, 18.96, 2, 2024, 6, 21, 1));
+    assert_all_day(schedule, 1);
+    schedule.Compile(&configuration, sun_times(69.65, 18.96, 1, 2024, 12, 21, 0));
+    assert_all_day(schedule, 1);
+    schedule.Compile(&configuration, sun_times(44.39, 7.55, 1, 2024, 3, 20, 1));
+    assert_all_day(schedule, 1);
+}
+
+// Sun times at Cuneo, for intervals at exact times only the day matters
+static SunTimes day_of(int year, int month, int day)
+{
+    return sun_times(44.39, 7.55, 1, year, month, day, 0.3);
+}
+
+static TimerInterval exact(int onHour, int offHour, uint8_t weekdays, uint16_t skipFrom = 0, uint16_t skipTo = 0)
+{
+    TimerInterval ti = interval(EXACT, onHour, 0, EXACT, offHour, 0);
+    ti.weekdays = weekdays;
+    ti.skipFrom = skipFrom;
+    ti.skipTo = skipTo;
+    return ti;
+}
+
+// Monday and Wednesday in the morning, every day in the evening, never at night
+void test_weekdays()
+{
+    configure({exact(8, 9, 1 << 1 | 1 << 3), exact(18, 19, 0), exact(20, 21, NO_WEEKDAYS)});
+    TEST_ASSERT_EQUAL(0, weekday(days_from_civil(2024, 5, 5)));
+
+    LampSchedule schedule;
+    for (int d = 0; d < 7; d++)
+    {
+        schedule.Compile(&configuration, day_of(2024, 5, 5 + d));
+        TEST_ASSERT_EQUAL(d == 1 || d == 3, schedule.GetState(8 * 3600 + 1800));
+        TEST_ASSERT_EQUAL(1, schedule.GetState(18 * 3600 + 1800));
+        TEST_ASSERT_EQUAL(0, schedule.GetState(20 * 3600 + 1800));
+    }
+}
+
+// Holidays in the morning across new year, in the evening in August; skipFrom alone skips nothing
+void test_skipped_dates()
+{
+    configure({exact(8, 9, 0, 1220, 106), exact(18, 19, 0, 801, 815), exact(20, 21, 0, 501, 0)});
+
+    static const struct
+    {
+        int year, month, day;
+        bool morning, evening;
+    } days[] = {{2024, 12, 19, true, true}, {2024, 12, 20, false, true}, {2024, 12, 31, false, true},
+                {2025, 1, 1, false, true},  {2025, 1, 6, false, true},   {2025, 1, 7, true, true},
+                {2024, 7, 31, true, true},  {2024, 8, 1, true, false},   {2024, 8, 15, true, false},
+                {2024, 8, 16, true, true},  {2024, 5, 1, true, true}};
+
+    LampSchedule schedule;
+    for (const auto &day : days)
+    {
+        schedule.Compile(&configuration, day_of(day.year, day.month, day.day));
+        TEST_ASSERT_EQUAL(day.morning, schedule.GetState(8 * 3600 + 1800));
+        TEST_ASSERT_EQUAL(day.evening, schedule.GetState(18 * 3600 + 1800));
+        TEST_ASSERT_EQUAL(1, schedule.GetState(20 * 3600 + 1800));
+    }
+}
+
+// The plans of the last two days are kept; saving the configuration makes them stale
+void test_plan_cache()
+{
+    configure({exact(8, 9, 1 << 1)});
+    PlanCache<LampSchedule> cache;
+    unsigned int revision = configuration.GetRevision();
+    long monday = days_from_civil(2024, 5, 6);
+
+    TEST_ASSERT_NULL(cache.Find(monday, revision));
+    LampSchedule *mondayPlan = cache.Insert(monday, revision);
+    mondayPlan->Compile(&configuration, day_of(2024, 5, 6));
+    LampSchedule *tuesdayPlan = cache.Insert(monday + 1, revision);
+    tuesdayPlan->Compile(&configuration, day_of(2024, 5, 7));
+    TEST_ASSERT_TRUE(mondayPlan != tuesdayPlan);
+    TEST_ASSERT_EQUAL_PTR(mondayPlan, cache.Find(monday, revision));
+    TEST_ASSERT_EQUAL_PTR(tuesdayPlan, cache.Find(monday + 1, revision));
+    TEST_ASSERT_EQUAL(1, cache.Find(monday, revision)->GetState(8 * 3600 + 1800));
+    TEST_ASSERT_EQUAL(0, cache.Find(monday + 1, revision)->GetState(8 * 3600 + 1800));
+
+    // A third day evicts the oldest
+    LampSchedule *wednesdayPlan = cache.Insert(monday + 2, revision);
+    wednesdayPlan->Compile(&configuration, day_of(2024, 5, 8));
+    TEST_ASSERT_NULL(cache.Find(monday, revision));
+    TEST_ASSERT_EQUAL_PTR(tuesdayPlan, cache.Find(monday + 1, revision));
+    TEST_ASSERT_EQUAL_PTR(wednesdayPlan, cache.Find(monday + 2, revision));
+
+    // Tuesday added: the cached plan of the old revision is not found
+    configure({exact(8, 9, 1 << 1 | 1 << 2)});
+    configuration.SaveConfiguration();
+    TEST_ASSERT_NOT_EQUAL(revision, configuration.GetRevision());
+    revision = configuration.GetRevision();
+    TEST_ASSERT_NULL(cache.Find(monday + 1, revision));
+    tuesdayPlan = cache.Insert(monday + 1, revision);
+    tuesdayPlan->Compile(&configuration, day_of(2024, 5, 7));
+    TEST_ASSERT_EQUAL(1, cache.Find(monday + 1, revision)->GetState(8 * 3600 + 1800));
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_irradiance_normal_day);
+    RUN_TEST(test_irradiance_always_above);
+    RUN_TEST(test_irradiance_never_reached);
+    RUN_TEST(test_weekdays);
+    RUN_TEST(test_skipped_dates);
+    RUN_TEST(test_plan_cache);
+    return UNITY_END();
+}
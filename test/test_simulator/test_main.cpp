@@ -0,0 +1,186 @@
+/**
+ * The whole firmware on a virtual clock: setup() and loop() of HelloServer.ino run on
+ * the core shims, time comes from NTP stand-ins over the simulated network, and the lamp
+ * relay is recorded. A year of sunset-to-sunrise schedule is checked at several places
+ * against the double Sunclock, with a millis() crystal 40 ppm off.
+ */
+#include <unity.h>
+#include <algorithm>
+#include <vector>
+#include "HelloServer.ino"
+#include "NtpServer.h"
+
+void setUp() {}
+void tearDown() {}
+
+struct Transition
+{
+    time_t time; // Recorded in UTC, compared in local time
+    bool on;
+};
+
+static std::vector<Transition> transitions;
+
+static sim::NtpServer servers[] = {
+    {"0.pool.ntp.org", IPAddress(10, 0, 0, 1)},
+    {"1.pool.ntp.org", IPAddress(10, 0, 0, 2)},
+    {"2.pool.ntp.org", IPAddress(10, 0, 0, 3)},
+    {"time.nist.gov", IPAddress(10, 0, 0, 4)}};
+
+static void run(unsigned long ms)
+{
+    unsigned long end = sim::now + ms;
+    while (sim::now < end)
+        loop();
+}
+
+static void boot()
+{
+    static bool booted = false;
+    if (booted)
+        return;
+    booted = true;
+
+    sim::utcAtZero = time_from_civil(2023, 12, 20, 10, 17, 3) * 1000ULL;
+    sim::crystalError = 40e-6;
+    sim::onDigitalWrite = [](uint8_t pin, uint8_t value) {
+        if (pin == lampPins[0])
+            transitions.push_back({(time_t)(sim::Utc() / 1000), value == LAMP_ON});
+    };
+
+    persistentConfiguration.SetSSID(sim::apSsid.c_str());
+    persistentConfiguration.SetPassword(sim::apPassword.c_str());
+    persistentConfiguration.SaveConfiguration();
+    setup();
+    run(60000);
+    TEST_ASSERT_FALSE(wifiManager.IsSetupMode());
+    TEST_ASSERT_TRUE(wifiManager.IsConnected());
+}
+
+// Through the settings page, as a user would: on at sunset, off at sunrise
+static void configure(float lat, float lng, float tz)
+{
+    std::map<String, String> args = {
+        {"lat", String(lat, 4)}, {"lng", String(lng, 4)}, {"tzoff", String(tz, 1)}, {"irrth", "0.1"},
+        {"onType0", "2"}, {"onTime0", ""}, {"offType0", "0"}, {"offTime0", "00:00"},
+        {"onType1", "0"}, {"onTime1", "00:00"}, {"offType1", "1"}, {"offTime1", ""},
+        {"onType2", "2"}, {"onTime2", ""}, {"offType2", "0"}, {"offTime2", "00:00"},
+        {"onType3", "0"}, {"onTime3", "00:00"}, {"offType3", "1"}, {"offTime3", ""}};
+    TEST_ASSERT_EQUAL(200, webServer.Request("/save-settings", args).code);
+}
+
+// Lamp transitions the configuration asks for, in local time: on from sunset to sunrise of each
+// local day by the double Sunclock, with sun times on another day left out as the plan does
+static std::vector<Transition> expected_transitions(float lat, float lng, float tz, time_t from, time_t to)
+{
+    Sunclock reference(lat, lng, tz);
+    long offset = (long)(tz * 3600);
+    std::vector<std::pair<time_t, time_t>> on; // Inclusive
+    for (long day = days_from_time(from) - 1; day <= days_from_time(to); day++)
+    {
+        time_t noon = (time_t)day * SECONDS_PER_DAY + SECONDS_PER_DAY / 2 - offset;
+        time_t rise = reference.sunrise(noon), set = reference.sunset(noon);
+        if (days_from_time(rise) == day)
+            on.push_back({(time_t)day * SECONDS_PER_DAY, rise});
+        if (days_from_time(set) == day)
+            on.push_back({set, (time_t)(day + 1) * SECONDS_PER_DAY - 1});
+    }
+
+    std::vector<Transition> transitions;
+    for (size_t i = 0; i < on.size(); i++)
+    {
+        time_t begin = on[i].first;
+        while (i + 1 < on.size() && on[i + 1].first <= on[i].second + 1)
+            i++;
+        if (begin > from && begin < to)
+            transitions.push_back({begin, true});
+        if (on[i].second + 1 > from && on[i].second + 1 < to)
+            transitions.push_back({on[i].second + 1, false});
+    }
+    return transitions;
+}
+
+#ifdef BITMAP_SCHEDULE
+static const long RESOLUTION = 60; // The bitmap rounds transitions to the minute
+#else
+static const long RESOLUTION = 0;
+#endif
+
+static void check_year(float lat, float lng, float tz, long tolerance)
+{
+    boot();
+    wifiManager.TurnWifiOn();
+    wifiTask.Wake();
+    run(10000);
+    configure(lat, lng, tz);
+    run(2 * 86400000UL);
+
+    transitions.clear();
+    long offset = (long)(tz * 3600);
+    // run() stops at the first wake after its end, compare a minute inside the year
+    time_t from = (time_t)(sim::Utc() / 1000) + offset + 60;
+    run(365 * 86400000UL);
+    time_t to = (time_t)(sim::Utc() / 1000) + offset - 60;
+
+    std::vector<Transition> expected = expected_transitions(lat, lng, tz, from, to), actual;
+    for (const Transition &t : transitions)
+    {
+        time_t local = t.time + offset;
+        if (local > from && local < to)
+            actual.push_back({local, t.on});
+    }
+
+    long worst = 0;
+    for (size_t i = 0; i < actual.size() && i < expected.size(); i++)
+    {
+        TEST_ASSERT_EQUAL(expected[i].on, actual[i].on);
+        worst = std::max(worst, labs((long)(actual[i].time - expected[i].time)));
+    }
+
+    printf("%.2f, %.2f (UTC%+.1f): %u transitions in a year, %u expected, worst %ld s from the reference\n",
+           lat, lng, tz, (unsigned)actual.size(), (unsigned)expected.size(), worst);
+    TEST_ASSERT_EQUAL(expected.size(), actual.size());
+    TEST_ASSERT_LESS_OR_EQUAL(tolerance + RESOLUTION, worst);
+}
+
+// Float is ill-conditioned close to the polar circle, see SunClock.hpp
+void test_year_cuneo() { check_year(44.3317f, 7.4774f, 1, 3); }
+void test_year_sydney() { check_year(-33.8688f, 151.2093f, 10, 3); }
+void test_year_quito() { check_year(-0.1807f, -78.4678f, -5, 3); }
+void test_year_anchorage() { check_year(61.2181f, -149.9003f, -9, 15); }
+void test_year_tromso() { check_year(69.6492f, 18.9553f, 1, 15); }
+
+// Pressing the button cuts a long sleep short and turns WiFi on
+void test_button_wakes_the_loop()
+{
+    boot();
+    // loop() one step at a time, up to a pass that goes to sleep for long with WiFi off
+    do
+    {
+        sleepUntilNextTask();
+        timeClient.takeSnapshot();
+        scheduler.Run();
+    } while (wifiManager.IsWifiOn() || scheduler.MillisToNextTask() < 60000);
+
+    unsigned long press = sim::now + 1234;
+    sim::Interrupt(D3, press);
+    sleepUntilNextTask();
+    TEST_ASSERT_EQUAL(press, sim::now);
+
+    timeClient.takeSnapshot();
+    scheduler.Run();
+    TEST_ASSERT_TRUE(wifiManager.IsWifiOn());
+    TEST_ASSERT_EQUAL(WIFI_STA, WiFi.getMode());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_button_wakes_the_loop);
+    RUN_TEST(test_year_cuneo);
+    RUN_TEST(test_year_sydney);
+    RUN_TEST(test_year_quito);
+    RUN_TEST(test_year_anchorage);
+    RUN_TEST(test_year_tromso);
+    return UNITY_END();
+}
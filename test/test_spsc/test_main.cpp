@@ -0,0 +1,139 @@
+/**
+ * SpscQueue under real concurrency: a producer thread, and a signal handler interrupting
+ * the consumer as the button ISR interrupts the loop. Every item pushed is popped once,
+ * in order, and a full queue drops the new items rather than overwriting.
+ */
+#include <unity.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <atomic>
+#include <thread>
+#include "SpscQueue.hpp"
+
+struct Item
+{
+    uint32_t sequence;
+    uint32_t check; // ~sequence, a torn item would not match
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_capacity()
+{
+    SpscQueue<Item, 8> queue;
+    Item item;
+    TEST_ASSERT_FALSE(queue.Pop(item));
+    for (uint32_t i = 0; i < 7; i++)
+        TEST_ASSERT_TRUE(queue.Push({i, ~i}));
+    TEST_ASSERT_FALSE(queue.Push({7, ~7u}));
+
+    // The dropped item did not overwrite the oldest
+    for (uint32_t i = 0; i < 7; i++)
+    {
+        TEST_ASSERT_TRUE(queue.Pop(item));
+        TEST_ASSERT_EQUAL(i, item.sequence);
+    }
+    TEST_ASSERT_FALSE(queue.Pop(item));
+}
+
+// The producer retries when the queue is full: every item comes out exactly once, in order
+void test_producer_thread()
+{
+    static const uint32_t COUNT = 200000;
+    SpscQueue<Item, 8> queue;
+    std::atomic<uint32_t> full{0};
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < COUNT; i++)
+            while (!queue.Push({i, ~i}))
+            {
+                full++;
+                std::this_thread::yield();
+            }
+    });
+
+    uint32_t popped = 0;
+    Item item;
+    while (popped < COUNT)
+    {
+        if (!queue.Pop(item))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        TEST_ASSERT_EQUAL(popped, item.sequence);
+        TEST_ASSERT_EQUAL(~item.sequence, item.check);
+        popped++;
+    }
+    producer.join();
+
+    printf("%u items, queue found full %u times\n", popped, (unsigned)full);
+    TEST_ASSERT_FALSE(queue.Pop(item));
+    TEST_ASSERT_GREATER_THAN(0, full);
+}
+
+static SpscQueue<Item, 8> *signalQueue;
+static volatile sig_atomic_t signalCount;
+static std::atomic<uint32_t> signalDropped;
+
+static void on_alarm(int)
+{
+    uint32_t sequence = signalCount;
+    if (!signalQueue->Push({sequence, ~sequence}))
+        signalDropped++;
+    signalCount = sequence + 1;
+}
+
+// The handler runs on the consumer's thread, in the middle of any Pop()
+void test_signal_handler()
+{
+    static const uint32_t COUNT = 20000;
+    SpscQueue<Item, 8> queue;
+    signalQueue = &queue;
+    signalCount = 0;
+    signalDropped = 0;
+
+    struct sigaction action = {};
+    action.sa_handler = on_alarm;
+    sigaction(SIGALRM, &action, nullptr);
+    itimerval timer = {{0, 20}, {0, 20}};
+    setitimer(ITIMER_REAL, &timer, nullptr);
+
+    uint32_t expected = 0, popped = 0;
+    Item item;
+    while ((uint32_t)signalCount < COUNT)
+    {
+        while (queue.Pop(item))
+        {
+            TEST_ASSERT_EQUAL(~item.sequence, item.check);
+            // Dropped items leave gaps, never reorder or repeat
+            TEST_ASSERT_GREATER_OR_EQUAL(expected, item.sequence);
+            expected = item.sequence + 1;
+            popped++;
+        }
+    }
+
+    timer = {};
+    setitimer(ITIMER_REAL, &timer, nullptr);
+    signal(SIGALRM, SIG_IGN);
+    while (queue.Pop(item))
+    {
+        TEST_ASSERT_EQUAL(~item.sequence, item.check);
+        TEST_ASSERT_GREATER_OR_EQUAL(expected, item.sequence);
+        expected = item.sequence + 1;
+        popped++;
+    }
+
+    printf("%u signals, %u popped, %u dropped\n", (unsigned)signalCount, popped, (unsigned)signalDropped);
+    TEST_ASSERT_EQUAL((uint32_t)signalCount, popped + signalDropped);
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_capacity);
+    RUN_TEST(test_producer_thread);
+    RUN_TEST(test_signal_handler);
+    return UNITY_END();
+}
@@ -0,0 +1,1648 @@
+// Generated by reference.py, do not edit
+// latitude, day (since 1970-01-01), solar noon, sunrise, sunset (unix time, longitude 0,
+// elevation -5 degrees, -1 if none), lowest and highest elevation within 12 h of noon (degrees)
+static const ReferenceDay REFERENCE[] = {
+    {-90, 18262, 1577880201, -1, -1, 22.98, 23.06},
+    {-90, 18269, 1578485191, -1, -1, 22.20, 22.34},
+    {-90, 18276, 1579090156, -1, -1, 21.07, 21.26},
+    {-90, 18283, 1579695089, -1, -1, 19.61, 19.84},
+    {-90, 18290, 1580299984, -1, -1, 17.86, 18.13},
+    {-90, 18297, 1580904840, -1, -1, 15.84, 16.14},
+    {-90, 18304, 1581509655, -1, -1, 13.60, 13.94},
+    {-90, 18311, 1582114434, -1, -1, 11.18, 11.54},
+    {-90, 18318, 1582719179, -1, -1, 8.62, 8.99},
+    {-90, 18325, 1583323897, -1, -1, 5.95, 6.34},
+    {-90, 18332, 1583928594, -1, -1, 3.22, 3.61},
+    {-90, 18339, 1584533275, -1, -1, 0.45, 0.85},
+    {-90, 18346, 1585137949, -1, -1, -2.30, -1.91},
+    {-90, 18353, 1585742623, -1, 1585780549, -5.02, -4.64},
+    {-90, 18360, 1586347302, -1, -1, -7.67, -7.30},
+    {-90, 18367, 1586951993, -1, -1, -10.21, -9.86},
+    {-90, 18374, 1587556703, -1, -1, -12.61, -12.28},
+    {-90, 18381, 1588161435, -1, -1, -14.85, -14.54},
+    {-90, 18388, 1588766192, -1, -1, -16.88, -16.61},
+    {-90, 18395, 1589370978, -1, -1, -18.69, -18.44},
+    {-90, 18402, 1589975791, -1, -1, -20.23, -20.03},
+    {-90, 18409, 1590580631, -1, -1, -21.50, -21.34},
+    {-90, 18416, 1591185493, -1, -1, -22.46, -22.34},
+    {-90, 18423, 1591790372, -1, -1, -23.10, -23.03},
+    {-90, 18430, 1592395262, -1, -1, -23.41, -23.38},
+    {-90, 18437, 1593000154, -1, -1, -23.40, -23.38},
+    {-90, 18444, 1593605040, -1, -1, -23.09, -23.01},
+    {-90, 18451, 1594209913, -1, -1, -22.44, -22.32},
+    {-90, 18458, 1594814765, -1, -1, -21.48, -21.32},
+    {-90, 18465, 1595419593, -1, -1, -20.22, -20.01},
+    {-90, 18472, 1596024392, -1, -1, -18.68, -18.44},
+    {-90, 18479, 1596629161, -1, -1, -16.90, -16.62},
+    {-90, 18486, 1597233901, -1, -1, -14.89, -14.58},
+    {-90, 18493, 1597838614, -1, -1, -12.69, -12.36},
+    {-90, 18500, 1598443303, -1, -1, -10.32, -9.97},
+    {-90, 18507, 1599047973, -1, -1, -7.82, -7.45},
+    {-90, 18514, 1599652631, -1, 1599659448, -5.22, -4.84},
+    {-90, 18521, 1600257281, -1, -1, -2.55, -2.16},
+    {-90, 18528, 1600861932, -1, -1, 0.17, 0.56},
+    {-90, 18535, 1601466589, -1, -1, 2.89, 3.28},
+    {-90, 18542, 1602071260, -1, -1, 5.59, 5.97},
+    {-90, 18549, 1602675951, -1, -1, 8.23, 8.60},
+    {-90, 18556, 1603280670, -1, -1, 10.78, 11.13},
+    {-90, 18563, 1603885422, -1, -1, 13.19, 13.53},
+    {-90, 18570, 1604490211, -1, -1, 15.44, 15.75},
+    {-90, 18577, 1605095041, -1, -1, 17.48, 17.75},
+    {-90, 18584, 1605699912, -1, -1, 19.28, 19.51},
+    {-90, 18591, 1606304824, -1, -1, 20.79, 20.98},
+    {-90, 18598, 1606909772, -1, -1, 21.98, 22.13},
+    {-90, 18605, 1607514751, -1, -1, 22.84, 22.93},
+    {-90, 18612, 1608119749, -1, -1, 23.32, 23.36},
+    {-90, 18619, 1608724758, -1, -1, 23.41, 23.43},
+    {-90, 18626, 1609329765, -1, -1, 23.08, 23.15},
+    {-85, 18262, 1577880166, -1, -1, 17.98, 28.02},
+    {-85, 18269, 1578485133, -1, -1, 17.20, 27.27},
+    {-85, 18276, 1579090077, -1, -1, 16.07, 26.17},
+    {-85, 18283, 1579694990, -1, -1, 14.61, 24.73},
+    {-85, 18290, 1580299868, -1, -1, 12.86, 22.99},
+    {-85, 18297, 1580904708, -1, -1, 10.84, 20.99},
+    {-85, 18304, 1581509511, -1, -1, 8.60, 18.77},
+    {-85, 18311, 1582114279, -1, -1, 6.18, 16.36},
+    {-85, 18318, 1582719016, -1, -1, 3.62, 13.81},
+    {-85, 18325, 1583323729, -1, -1, 0.95, 11.15},
+    {-85, 18332, 1583928422, -1, -1, -1.78, 8.42},
+    {-85, 18339, 1584533103, -1, -1, -4.54, 5.65},
+    {-85, 18346, 1585137778, 1585107375, 1585167604, -7.30, 2.89},
+    {-85, 18353, 1585742455, 1585720239, 1585764468, -10.02, 0.17},
+    {-85, 18360, 1586347139, 1586332595, 1586361616, -12.67, -2.48},
+    {-85, 18367, 1586951838, -1, -1, -15.21, -5.03},
+    {-85, 18374, 1587556557, -1, -1, -17.61, -7.45},
+    {-85, 18381, 1588161300, -1, -1, -19.85, -9.70},
+    {-85, 18388, 1588766071, -1, -1, -21.88, -11.74},
+    {-85, 18395, 1589370872, -1, -1, -23.69, -13.57},
+    {-85, 18402, 1589975702, -1, -1, -25.23, -15.13},
+    {-85, 18409, 1590580560, -1, -1, -26.50, -16.42},
+    {-85, 18416, 1591185442, -1, -1, -27.46, -17.40},
+    {-85, 18423, 1591790341, -1, -1, -28.10, -18.06},
+    {-85, 18430, 1592395252, -1, -1, -28.41, -18.40},
+    {-85, 18437, 1593000165, -1, -1, -28.40, -18.39},
+    {-85, 18444, 1593605072, -1, -1, -28.09, -18.05},
+    {-85, 18451, 1594209964, -1, -1, -27.44, -17.38},
+    {-85, 18458, 1594814836, -1, -1, -26.48, -16.40},
+    {-85, 18465, 1595419681, -1, -1, -25.22, -15.12},
+    {-85, 18472, 1596024497, -1, -1, -23.68, -13.56},
+    {-85, 18479, 1596629280, -1, -1, -21.90, -11.76},
+    {-85, 18486, 1597234033, -1, -1, -19.89, -9.74},
+    {-85, 18493, 1597838757, -1, -1, -17.68, -7.52},
+    {-85, 18500, 1598443456, -1, -1, -15.32, -5.15},
+    {-85, 18507, 1599048133, 1599034147, 1599062181, -12.82, -2.64},
+    {-85, 18514, 1599652796, 1599631320, 1599674457, -10.22, -0.03},
+    {-85, 18521, 1600257450, 1600228398, 1600287011, -7.54, 2.65},
+    {-85, 18528, 1600862101, -1, -1, -4.83, 5.36},
+    {-85, 18535, 1601466758, -1, -1, -2.11, 8.09},
+    {-85, 18542, 1602071426, -1, -1, 0.59, 10.78},
+    {-85, 18549, 1602676113, -1, -1, 3.23, 13.42},
+    {-85, 18556, 1603280825, -1, -1, 5.78, 15.96},
+    {-85, 18563, 1603885567, -1, -1, 8.19, 18.36},
+    {-85, 18570, 1604490344, -1, -1, 10.44, 20.59},
+    {-85, 18577, 1605095160, -1, -1, 12.48, 22.62},
+    {-85, 18584, 1605700015, -1, -1, 14.28, 24.39},
+    {-85, 18591, 1606304908, -1, -1, 15.79, 25.88},
+    {-85, 18598, 1606909835, -1, -1, 16.98, 27.06},
+    {-85, 18605, 1607514791, -1, -1, 17.84, 27.88},
+    {-85, 18612, 1608119766, -1, -1, 18.32, 28.34},
+    {-85, 18619, 1608724751, -1, -1, 18.41, 28.42},
+    {-85, 18626, 1609329734, -1, -1, 18.08, 28.11},
+    {-80, 18262, 1577880183, -1, -1, 12.98, 33.02},
+    {-80, 18269, 1578485162, -1, -1, 12.20, 32.27},
+    {-80, 18276, 1579090117, -1, -1, 11.07, 31.16},
+    {-80, 18283, 1579695040, -1, -1, 9.61, 29.73},
+    {-80, 18290, 1580299926, -1, -1, 7.86, 27.99},
+    {-80, 18297, 1580904774, -1, -1, 5.84, 25.99},
+    {-80, 18304, 1581509584, -1, -1, 3.60, 23.77},
+    {-80, 18311, 1582114357, -1, -1, 1.18, 21.36},
+    {-80, 18318, 1582719099, -1, -1, -1.38, 18.81},
+    {-80, 18325, 1583323814, -1, -1, -4.05, 16.15},
+    {-80, 18332, 1583928508, 1583892829, 1583963537, -6.78, 13.42},
+    {-80, 18339, 1584533190, 1584503170, 1584562928, -9.54, 10.65},
+    {-80, 18346, 1585137864, 1585112091, 1585163476, -12.30, 7.89},
+    {-80, 18353, 1585742539, 1585720559, 1585764422, -15.02, 5.17},
+    {-80, 18360, 1586347221, 1586328912, 1586365474, -17.67, 2.52},
+    {-80, 18367, 1586951916, 1586937404, 1586966398, -20.21, -0.03},
+    {-80, 18374, 1587556631, 1587546438, 1587566810, -22.61, -2.45},
+    {-80, 18381, 1588161368, 1588157905, 1588164830, -24.85, -4.70},
+    {-80, 18388, 1588766132, -1, -1, -26.88, -6.74},
+    {-80, 18395, 1589370925, -1, -1, -28.69, -8.57},
+    {-80, 18402, 1589975747, -1, -1, -30.23, -10.13},
+    {-80, 18409, 1590580596, -1, -1, -31.50, -11.42},
+    {-80, 18416, 1591185468, -1, -1, -32.46, -12.40},
+    {-80, 18423, 1591790357, -1, -1, -33.10, -13.06},
+    {-80, 18430, 1592395257, -1, -1, -33.41, -13.40},
+    {-80, 18437, 1593000159, -1, -1, -33.40, -13.39},
+    {-80, 18444, 1593605056, -1, -1, -33.09, -13.05},
+    {-80, 18451, 1594209938, -1, -1, -32.44, -12.38},
+    {-80, 18458, 1594814800, -1, -1, -31.48, -11.40},
+    {-80, 18465, 1595419637, -1, -1, -30.22, -10.12},
+    {-80, 18472, 1596024444, -1, -1, -28.68, -8.56},
+    {-80, 18479, 1596629220, -1, -1, -26.90, -6.76},
+    {-80, 18486, 1597233967, 1597230747, 1597237187, -24.89, -4.74},
+    {-80, 18493, 1597838685, 1597828659, 1597848723, -22.69, -2.52},
+    {-80, 18500, 1598443379, 1598429075, 1598457712, -20.32, -0.15},
+    {-80, 18507, 1599048053, 1599030017, 1599066143, -17.82, 2.36},
+    {-80, 18514, 1599652713, 1599631098, 1599674419, -15.22, 4.97},
+    {-80, 18521, 1600257365, 1600232095, 1600282786, -12.54, 7.65},
+    {-80, 18528, 1600862016, 1600832739, 1600891552, -9.83, 10.36},
+    {-80, 18535, 1601466673, 1601432402, 1601501500, -7.11, 13.09},
+    {-80, 18542, 1602071342, -1, -1, -4.41, 15.78},
+    {-80, 18549, 1602676032, -1, -1, -1.77, 18.42},
+    {-80, 18556, 1603280747, -1, -1, 0.78, 20.96},
+    {-80, 18563, 1603885494, -1, -1, 3.19, 23.36},
+    {-80, 18570, 1604490277, -1, -1, 5.44, 25.59},
+    {-80, 18577, 1605095100, -1, -1, 7.48, 27.62},
+    {-80, 18584, 1605699963, -1, -1, 9.28, 29.39},
+    {-80, 18591, 1606304866, -1, -1, 10.79, 30.88},
+    {-80, 18598, 1606909804, -1, -1, 11.98, 32.06},
+    {-80, 18605, 1607514771, -1, -1, 12.84, 32.88},
+    {-80, 18612, 1608119758, -1, -1, 13.32, 33.34},
+    {-80, 18619, 1608724755, -1, -1, 13.41, 33.42},
+    {-80, 18626, 1609329750, -1, -1, 13.08, 33.11},
+    {-75, 18262, 1577880189, -1, -1, 7.98, 38.02},
+    {-75, 18269, 1578485172, -1, -1, 7.20, 37.27},
+    {-75, 18276, 1579090130, -1, -1, 6.07, 36.16},
+    {-75, 18283, 1579695057, -1, -1, 4.61, 34.73},
+    {-75, 18290, 1580299946, -1, -1, 2.86, 32.99},
+    {-75, 18297, 1580904797, -1, -1, 0.84, 30.99},
+    {-75, 18304, 1581509608, -1, -1, -1.40, 28.77},
+    {-75, 18311, 1582114383, -1, -1, -3.82, 26.36},
+    {-75, 18318, 1582719126, 1582681154, 1582756431, -6.38, 23.81},
+    {-75, 18325, 1583323842, 1583290630, 1583356759, -9.05, 21.15},
+    {-75, 18332, 1583928538, 1583898674, 1583958215, -11.78, 18.42},
+    {-75, 18339, 1584533219, 1584506211, 1584560100, -14.54, 15.65},
+    {-75, 18346, 1585137893, 1585113490, 1585162208, -17.30, 12.89},
+    {-75, 18353, 1585742568, 1585720631, 1585764442, -20.02, 10.17},
+    {-75, 18360, 1586347249, 1586327710, 1586366744, -22.67, 7.52},
+    {-75, 18367, 1586951943, 1586934786, 1586969070, -25.21, 4.97},
+    {-75, 18374, 1587556655, 1587541916, 1587571376, -27.61, 2.55},
+    {-75, 18381, 1588161391, 1588149170, 1588173601, -29.85, 0.30},
+    {-75, 18388, 1588766153, 1588756661, 1588775639, -31.88, -1.74},
+    {-75, 18395, 1589370943, 1589364687, 1589377198, -33.69, -3.57},
+    {-75, 18402, 1589975762, -1, -1, -35.23, -5.13},
+    {-75, 18409, 1590580608, -1, -1, -36.50, -6.42},
+    {-75, 18416, 1591185476, -1, -1, -37.46, -7.40},
+    {-75, 18423, 1591790362, -1, -1, -38.10, -8.06},
+    {-75, 18430, 1592395259, -1, -1, -38.41, -8.40},
+    {-75, 18437, 1593000157, -1, -1, -38.40, -8.39},
+    {-75, 18444, 1593605050, -1, -1, -38.09, -8.05},
+    {-75, 18451, 1594209930, -1, -1, -37.44, -7.38},
+    {-75, 18458, 1594814788, -1, -1, -36.48, -6.40},
+    {-75, 18465, 1595419622, -1, -1, -35.22, -5.12},
+    {-75, 18472, 1596024426, 1596018163, 1596030690, -33.68, -3.56},
+    {-75, 18479, 1596629200, 1596619736, 1596638669, -31.90, -1.76},
+    {-75, 18486, 1597233944, 1597221784, 1597246115, -29.89, 0.26},
+    {-75, 18493, 1597838660, 1597824018, 1597853321, -27.69, 2.48},
+    {-75, 18500, 1598443353, 1598426332, 1598460401, -25.32, 4.85},
+    {-75, 18507, 1599048026, 1599028670, 1599067423, -22.82, 7.36},
+    {-75, 18514, 1599652685, 1599630988, 1599674441, -20.22, 9.97},
+    {-75, 18521, 1600257336, 1600233243, 1600281514, -17.54, 12.65},
+    {-75, 18528, 1600861987, 1600835382, 1600888712, -14.83, 15.36},
+    {-75, 18535, 1601466644, 1601437317, 1601496144, -12.11, 18.09},
+    {-75, 18542, 1602071314, 1602038872, 1602104027, -9.41, 20.78},
+    {-75, 18549, 1602676004, 1602639505, 1602713052, -6.77, 23.42},
+    {-75, 18556, 1603280721, -1, -1, -4.22, 25.95},
+    {-75, 18563, 1603885469, -1, -1, -1.81, 28.36},
+    {-75, 18570, 1604490255, -1, -1, 0.44, 30.59},
+    {-75, 18577, 1605095080, -1, -1, 2.48, 32.62},
+    {-75, 18584, 1605699946, -1, -1, 4.28, 34.39},
+    {-75, 18591, 1606304851, -1, -1, 5.79, 35.88},
+    {-75, 18598, 1606909793, -1, -1, 6.98, 37.06},
+    {-75, 18605, 1607514764, -1, -1, 7.84, 37.88},
+    {-75, 18612, 1608119755, -1, -1, 8.32, 38.34},
+    {-75, 18619, 1608724756, -1, -1, 8.41, 38.42},
+    {-75, 18626, 1609329755, -1, -1, 8.08, 38.11},
+    {-70, 18262, 1577880192, -1, -1, 2.98, 43.02},
+    {-70, 18269, 1578485177, -1, -1, 2.20, 42.27},
+    {-70, 18276, 1579090137, -1, -1, 1.07, 41.16},
+    {-70, 18283, 1579695065, -1, -1, -0.39, 39.73},
+    {-70, 18290, 1580299956, -1, -1, -2.14, 37.99},
+    {-70, 18297, 1580904808, -1, -1, -4.16, 35.99},
+    {-70, 18304, 1581509621, 1581471102, 1581547606, -6.40, 33.77},
+    {-70, 18311, 1582114397, 1582079631, 1582148890, -8.82, 31.36},
+    {-70, 18318, 1582719140, 1582687101, 1582750994, -11.38, 28.81},
+    {-70, 18325, 1583323857, 1583294149, 1583353428, -14.05, 26.15},
+    {-70, 18332, 1583928552, 1583900956, 1583956045, -16.78, 23.42},
+    {-70, 18339, 1584533234, 1584507609, 1584558780, -19.54, 20.65},
+    {-70, 18346, 1585137908, 1585114158, 1585161598, -22.30, 17.89},
+    {-70, 18353, 1585742582, 1585720640, 1585764479, -25.02, 15.17},
+    {-70, 18360, 1586347263, 1586327081, 1586367411, -27.67, 12.52},
+    {-70, 18367, 1586951956, 1586933500, 1586970387, -30.21, 9.97},
+    {-70, 18374, 1587556668, 1587539912, 1587573405, -32.61, 7.55},
+    {-70, 18381, 1588161402, 1588146326, 1588176467, -34.85, 5.30},
+    {-70, 18388, 1588766163, 1588752742, 1588779577, -36.88, 3.26},
+    {-70, 18395, 1589370952, 1589359153, 1589382747, -38.69, 1.43},
+    {-70, 18402, 1589975770, 1589965538, 1589985999, -40.23, -0.13},
+    {-70, 18409, 1590580614, 1590571855, 1590589371, -41.50, -1.42},
+    {-70, 18416, 1591185481, 1591178031, 1591192930, -42.46, -2.40},
+    {-70, 18423, 1591790365, 1591783942, 1591796788, -43.10, -3.06},
+    {-70, 18430, 1592395260, 1592389415, 1592401104, -43.41, -3.40},
+    {-70, 18437, 1593000156, 1592994304, 1593006009, -43.40, -3.39},
+    {-70, 18444, 1593605048, 1593598602, 1593611493, -43.09, -3.05},
+    {-70, 18451, 1594209925, 1594202449, 1594217402, -42.44, -2.38},
+    {-70, 18458, 1594814782, 1594806001, 1594823566, -41.48, -1.40},
+    {-70, 18465, 1595419614, 1595409369, 1595429862, -40.22, -0.12},
+    {-70, 18472, 1596024417, 1596012619, 1596036220, -38.68, 1.44},
+    {-70, 18479, 1596629190, 1596615789, 1596642598, -36.90, 3.24},
+    {-70, 18486, 1597233933, 1597218900, 1597248977, -34.89, 5.26},
+    {-70, 18493, 1597838648, 1597821964, 1597855350, -32.69, 7.48},
+    {-70, 18500, 1598443340, 1598424986, 1598461718, -30.32, 9.85},
+    {-70, 18507, 1599048012, 1599027967, 1599068090, -27.82, 12.36},
+    {-70, 18514, 1599652670, 1599630905, 1599674480, -25.22, 14.97},
+    {-70, 18521, 1600257322, 1600233794, 1600280907, -22.54, 17.65},
+    {-70, 18528, 1600861972, 1600836624, 1600887396, -19.83, 20.36},
+    {-70, 18535, 1601466629, 1601439375, 1601493982, -17.11, 23.09},
+    {-70, 18542, 1602071300, 1602042018, 1602100711, -14.41, 25.78},
+    {-70, 18549, 1602675990, 1602644493, 1602707661, -11.77, 28.42},
+    {-70, 18556, 1603280707, 1603246679, 1603314986, -9.22, 30.95},
+    {-70, 18563, 1603885457, 1603848204, 1603923153, -6.81, 33.36},
+    {-70, 18570, 1604490243, -1, -1, -4.56, 35.59},
+    {-70, 18577, 1605095070, -1, -1, -2.52, 37.62},
+    {-70, 18584, 1605699937, -1, -1, -0.72, 39.39},
+    {-70, 18591, 1606304844, -1, -1, 0.79, 40.88},
+    {-70, 18598, 1606909788, -1, -1, 1.98, 42.06},
+    {-70, 18605, 1607514760, -1, -1, 2.84, 42.88},
+    {-70, 18612, 1608119753, -1, -1, 3.32, 43.34},
+    {-70, 18619, 1608724756, -1, -1, 3.41, 43.42},
+    {-70, 18626, 1609329758, -1, -1, 3.08, 43.11},
+    {-68, 18262, 1577880193, -1, -1, 0.98, 45.02},
+    {-68, 18269, 1578485179, -1, -1, 0.20, 44.27},
+    {-68, 18276, 1579090139, -1, -1, -0.93, 43.16},
+    {-68, 18283, 1579695068, -1, -1, -2.39, 41.73},
+    {-68, 18290, 1580299959, -1, -1, -4.14, 39.99},
+    {-68, 18297, 1580904811, 1580865632, 1580943455, -6.16, 37.99},
+    {-68, 18304, 1581509624, 1581474016, 1581544960, -8.40, 35.77},
+    {-68, 18311, 1582114400, 1582081360, 1582147251, -10.82, 33.36},
+    {-68, 18318, 1582719144, 1582688299, 1582749847, -13.38, 30.81},
+    {-68, 18325, 1583323861, 1583295001, 1583352610, -16.05, 28.15},
+    {-68, 18332, 1583928556, 1583901546, 1583955480, -18.78, 25.42},
+    {-68, 18339, 1584533238, 1584507980, 1584558428, -21.54, 22.65},
+    {-68, 18346, 1585137912, 1585114335, 1585161436, -24.30, 19.89},
+    {-68, 18353, 1585742586, 1585720636, 1585764496, -27.02, 17.17},
+    {-68, 18360, 1586347267, 1586326901, 1586367601, -29.67, 14.52},
+    {-68, 18367, 1586951960, 1586933143, 1586970753, -32.21, 11.97},
+    {-68, 18374, 1587556671, 1587539372, 1587573954, -34.61, 9.55},
+    {-68, 18381, 1588161406, 1588145589, 1588177210, -36.85, 7.30},
+    {-68, 18388, 1588766166, 1588751790, 1588780534, -38.88, 5.26},
+    {-68, 18395, 1589370955, 1589357960, 1589383944, -40.69, 3.43},
+    {-68, 18402, 1589975772, 1589964073, 1589987467, -42.23, 1.87},
+    {-68, 18409, 1590580616, 1590570086, 1590591143, -43.50, 0.58},
+    {-68, 18416, 1591185482, 1591175934, 1591195029, -44.46, -0.40},
+    {-68, 18423, 1591790366, 1591781539, 1591799192, -45.10, -1.06},
+    {-68, 18430, 1592395260, 1592386816, 1592403704, -45.41, -1.40},
+    {-68, 18437, 1593000156, 1592991707, 1593008606, -45.40, -1.39},
+    {-68, 18444, 1593605047, 1593596205, 1593613889, -45.09, -1.05},
+    {-68, 18451, 1594209924, 1594200357, 1594219492, -44.44, -0.38},
+    {-68, 18458, 1594814781, 1594804234, 1594825330, -43.48, 0.60},
+    {-68, 18465, 1595419612, 1595407904, 1595431324, -42.22, 1.88},
+    {-68, 18472, 1596024414, 1596011423, 1596037412, -40.68, 3.44},
+    {-68, 18479, 1596629187, 1596614830, 1596643552, -38.90, 5.24},
+    {-68, 18486, 1597233929, 1597218153, 1597249718, -36.89, 7.26},
+    {-68, 18493, 1597838645, 1597821410, 1597855896, -34.69, 9.48},
+    {-68, 18500, 1598443336, 1598424612, 1598462083, -32.32, 11.85},
+    {-68, 18507, 1599048008, 1599027766, 1599068280, -29.82, 14.36},
+    {-68, 18514, 1599652667, 1599630875, 1599674497, -27.22, 16.97},
+    {-68, 18521, 1600257318, 1600233939, 1600280747, -24.54, 19.65},
+    {-68, 18528, 1600861968, 1600836955, 1600887047, -21.83, 22.36},
+    {-68, 18535, 1601466625, 1601439913, 1601493420, -19.11, 25.09},
+    {-68, 18542, 1602071296, 1602042799, 1602099898, -16.41, 27.78},
+    {-68, 18549, 1602675986, 1602645585, 1602706523, -13.77, 30.42},
+    {-68, 18556, 1603280704, 1603248220, 1603313365, -11.22, 32.95},
+    {-68, 18563, 1603885453, 1603850590, 1603920567, -8.81, 35.36},
+    {-68, 18570, 1604490240, 1604452341, 1604528577, -6.56, 37.59},
+    {-68, 18577, 1605095067, -1, -1, -4.52, 39.62},
+    {-68, 18584, 1605699935, -1, -1, -2.72, 41.39},
+    {-68, 18591, 1606304842, -1, -1, -1.21, 42.88},
+    {-68, 18598, 1606909786, -1, -1, -0.02, 44.06},
+    {-68, 18605, 1607514759, -1, -1, 0.84, 44.88},
+    {-68, 18612, 1608119753, -1, -1, 1.32, 45.34},
+    {-68, 18619, 1608724757, -1, -1, 1.41, 45.42},
+    {-68, 18626, 1609329758, -1, -1, 1.08, 45.11},
+    {-66, 18262, 1577880194, -1, -1, -1.02, 47.02},
+    {-66, 18269, 1578485180, -1, -1, -1.80, 46.27},
+    {-66, 18276, 1579090141, -1, -1, -2.93, 45.16},
+    {-66, 18283, 1579695070, -1, -1, -4.39, 43.73},
+    {-66, 18290, 1580299961, 1580260670, 1580338792, -6.14, 41.99},
+    {-66, 18297, 1580904814, 1580868663, 1580940707, -8.16, 39.99},
+    {-66, 18304, 1581509627, 1581475825, 1581543242, -10.40, 37.77},
+    {-66, 18311, 1582114404, 1582082639, 1582146023, -12.82, 35.36},
+    {-66, 18318, 1582719147, 1582689239, 1582748940, -15.38, 32.81},
+    {-66, 18325, 1583323864, 1583295690, 1583351946, -18.05, 30.15},
+    {-66, 18332, 1583928560, 1583902029, 1583955016, -20.78, 27.42},
+    {-66, 18339, 1584533241, 1584508286, 1584558138, -23.54, 24.65},
+    {-66, 18346, 1585137916, 1585114480, 1585161304, -26.30, 21.89},
+    {-66, 18353, 1585742590, 1585720629, 1585764513, -29.02, 19.17},
+    {-66, 18360, 1586347270, 1586326746, 1586367765, -31.67, 16.52},
+    {-66, 18367, 1586951963, 1586932841, 1586971063, -34.21, 13.97},
+    {-66, 18374, 1587556674, 1587538919, 1587574414, -36.61, 11.55},
+    {-66, 18381, 1588161408, 1588144979, 1588177826, -38.85, 9.30},
+    {-66, 18388, 1588766169, 1588751014, 1588781315, -40.88, 7.26},
+    {-66, 18395, 1589370957, 1589357009, 1589384900, -42.69, 5.43},
+    {-66, 18402, 1589975774, 1589962937, 1589988607, -44.23, 3.87},
+    {-66, 18409, 1590580617, 1590568760, 1590592472, -45.50, 2.58},
+    {-66, 18416, 1591185483, 1591174429, 1591196536, -46.46, 1.60},
+    {-66, 18423, 1591790366, 1591779886, 1591800846, -47.10, 0.94},
+    {-66, 18430, 1592395260, 1592385079, 1592405441, -47.41, 0.60},
+    {-66, 18437, 1593000156, 1592989971, 1593010341, -47.40, 0.61},
+    {-66, 18444, 1593605046, 1593594555, 1593615538, -47.09, 0.95},
+    {-66, 18451, 1594209923, 1594198854, 1594220993, -46.44, 1.62},
+    {-66, 18458, 1594814779, 1594802909, 1594826652, -45.48, 2.60},
+    {-66, 18465, 1595419610, 1595406766, 1595432458, -44.22, 3.88},
+    {-66, 18472, 1596024412, 1596010468, 1596038363, -42.68, 5.44},
+    {-66, 18479, 1596629184, 1596614048, 1596644329, -40.90, 7.24},
+    {-66, 18486, 1597233927, 1597217534, 1597250331, -38.89, 9.26},
+    {-66, 18493, 1597838642, 1597820945, 1597856354, -36.69, 11.48},
+    {-66, 18500, 1598443333, 1598424295, 1598462392, -34.32, 13.85},
+    {-66, 18507, 1599048005, 1599027593, 1599068444, -31.82, 16.36},
+    {-66, 18514, 1599652663, 1599630846, 1599674515, -29.22, 18.97},
+    {-66, 18521, 1600257314, 1600234058, 1600280616, -26.54, 21.65},
+    {-66, 18528, 1600861965, 1600837228, 1600886759, -23.83, 24.36},
+    {-66, 18535, 1601466622, 1601440356, 1601492959, -21.11, 27.09},
+    {-66, 18542, 1602071292, 1602043434, 1602099239, -18.41, 29.78},
+    {-66, 18549, 1602675983, 1602646452, 1602705625, -15.77, 32.42},
+    {-66, 18556, 1603280701, 1603249388, 1603312151, -13.22, 34.95},
+    {-66, 18563, 1603885450, 1603852202, 1603918876, -10.81, 37.36},
+    {-66, 18570, 1604490237, 1604454802, 1604525911, -8.56, 39.59},
+    {-66, 18577, 1605095064, 1605056915, 1605133600, -6.52, 41.62},
+    {-66, 18584, 1605699933, -1, -1, -4.72, 43.39},
+    {-66, 18591, 1606304841, -1, -1, -3.21, 44.88},
+    {-66, 18598, 1606909785, -1, -1, -2.02, 46.06},
+    {-66, 18605, 1607514758, -1, -1, -1.16, 46.88},
+    {-66, 18612, 1608119753, -1, -1, -0.68, 47.34},
+    {-66, 18619, 1608724757, -1, -1, -0.59, 47.42},
+    {-66, 18626, 1609329759, -1, -1, -0.92, 47.11},
+    {-64, 18262, 1577880195, -1, -1, -3.02, 49.02},
+    {-64, 18269, 1578485181, -1, -1, -3.80, 48.27},
+    {-64, 18276, 1579090142, -1, -1, -4.93, 47.16},
+    {-64, 18283, 1579695071, 1579656213, 1579733597, -6.39, 45.73},
+    {-64, 18290, 1580299963, 1580263596, 1580336106, -8.14, 43.99},
+    {-64, 18297, 1580904816, 1580870500, 1580938957, -10.16, 41.99},
+    {-64, 18304, 1581509629, 1581477157, 1581541960, -12.40, 39.77},
+    {-64, 18311, 1582114406, 1582083645, 1582145051, -14.82, 37.36},
+    {-64, 18318, 1582719150, 1582690004, 1582748200, -17.38, 34.81},
+    {-64, 18325, 1583323867, 1583296260, 1583351395, -20.05, 32.15},
+    {-64, 18332, 1583928563, 1583902434, 1583954627, -22.78, 29.42},
+    {-64, 18339, 1584533244, 1584508542, 1584557894, -25.55, 26.65},
+    {-64, 18346, 1585137919, 1585114600, 1585161195, -28.30, 23.89},
+    {-64, 18353, 1585742592, 1585720619, 1585764532, -31.02, 21.17},
+    {-64, 18360, 1586347273, 1586326611, 1586367909, -33.67, 18.52},
+    {-64, 18367, 1586951966, 1586932580, 1586971331, -36.21, 15.97},
+    {-64, 18374, 1587556677, 1587538532, 1587574807, -38.61, 13.55},
+    {-64, 18381, 1588161411, 1588144463, 1588178347, -40.85, 11.30},
+    {-64, 18388, 1588766171, 1588750365, 1588781968, -42.88, 9.26},
+    {-64, 18395, 1589370959, 1589356224, 1589385688, -44.69, 7.43},
+    {-64, 18402, 1589975775, 1589962015, 1589989532, -46.23, 5.87},
+    {-64, 18409, 1590580618, 1590567705, 1590593529, -47.50, 4.58},
+    {-64, 18416, 1591185484, 1591173255, 1591197711, -48.46, 3.60},
+    {-64, 18423, 1591790367, 1591778621, 1591802112, -49.10, 2.94},
+    {-64, 18430, 1592395260, 1592383763, 1592406757, -49.41, 2.60},
+    {-64, 18437, 1593000156, 1592988655, 1593011657, -49.40, 2.61},
+    {-64, 18444, 1593605046, 1593593290, 1593616802, -49.09, 2.95},
+    {-64, 18451, 1594209922, 1594197681, 1594222164, -48.44, 3.62},
+    {-64, 18458, 1594814778, 1594801854, 1594827705, -47.48, 4.60},
+    {-64, 18465, 1595419609, 1595405842, 1595433379, -46.22, 5.88},
+    {-64, 18472, 1596024410, 1596009679, 1596039148, -44.68, 7.44},
+    {-64, 18479, 1596629182, 1596613394, 1596644979, -42.90, 9.24},
+    {-64, 18486, 1597233925, 1597217011, 1597250850, -40.89, 11.26},
+    {-64, 18493, 1597838639, 1597820548, 1597856745, -38.69, 13.48},
+    {-64, 18500, 1598443330, 1598424022, 1598462658, -36.32, 15.85},
+    {-64, 18507, 1599048002, 1599027443, 1599068587, -33.82, 18.36},
+    {-64, 18514, 1599652660, 1599630819, 1599674534, -31.22, 20.97},
+    {-64, 18521, 1600257311, 1600234156, 1600280508, -28.54, 23.65},
+    {-64, 18528, 1600861962, 1600837458, 1600886517, -25.83, 26.36},
+    {-64, 18535, 1601466619, 1601440727, 1601492574, -23.11, 29.09},
+    {-64, 18542, 1602071290, 1602043962, 1602098693, -20.41, 31.78},
+    {-64, 18549, 1602675980, 1602647162, 1602704892, -17.77, 34.42},
+    {-64, 18556, 1603280698, 1603250319, 1603311189, -15.22, 36.95},
+    {-64, 18563, 1603885448, 1603853421, 1603917610, -12.81, 39.36},
+    {-64, 18570, 1604490235, 1604456445, 1604524191, -10.56, 41.59},
+    {-64, 18577, 1605095062, 1605059337, 1605130999, -8.52, 43.62},
+    {-64, 18584, 1605699931, 1605661952, 1605738207, -6.72, 45.39},
+    {-64, 18591, 1606304839, 1606263448, 1606347431, -5.21, 46.88},
+    {-64, 18598, 1606909784, -1, -1, -4.02, 48.06},
+    {-64, 18605, 1607514758, -1, -1, -3.16, 48.88},
+    {-64, 18612, 1608119752, -1, -1, -2.68, 49.34},
+    {-64, 18619, 1608724757, -1, -1, -2.59, 49.42},
+    {-64, 18626, 1609329759, -1, -1, -2.92, 49.11},
+    {-62, 18262, 1577880195, -1, 1577922837, -5.02, 51.02},
+    {-62, 18269, 1578485182, 1578445166, 1578524932, -5.80, 50.27},
+    {-62, 18276, 1579090143, 1579052107, 1579127971, -6.93, 49.16},
+    {-62, 18283, 1579695073, 1579658820, 1579731148, -8.39, 47.73},
+    {-62, 18290, 1580299965, 1580265393, 1580334383, -10.14, 45.99},
+    {-62, 18297, 1580904818, 1580871852, 1580937651, -12.16, 43.99},
+    {-62, 18304, 1581509632, 1581478207, 1581540942, -14.40, 41.77},
+    {-62, 18311, 1582114408, 1582084467, 1582144252, -16.82, 39.36},
+    {-62, 18318, 1582719153, 1582690642, 1582747581, -19.38, 36.81},
+    {-62, 18325, 1583323870, 1583296741, 1583350929, -22.05, 34.15},
+    {-62, 18332, 1583928565, 1583902777, 1583954296, -24.78, 31.42},
+    {-62, 18339, 1584533247, 1584508760, 1584557687, -27.55, 28.65},
+    {-62, 18346, 1585137921, 1585114700, 1585161104, -30.30, 25.89},
+    {-62, 18353, 1585742595, 1585720608, 1585764551, -33.02, 23.17},
+    {-62, 18360, 1586347275, 1586326490, 1586368036, -35.67, 20.52},
+    {-62, 18367, 1586951968, 1586932352, 1586971565, -38.21, 17.97},
+    {-62, 18374, 1587556679, 1587538195, 1587575148, -40.61, 15.55},
+    {-62, 18381, 1588161413, 1588144018, 1588178797, -42.85, 13.30},
+    {-62, 18388, 1588766173, 1588749810, 1588782527, -44.88, 11.26},
+    {-62, 18395, 1589370961, 1589355559, 1589386356, -46.69, 9.43},
+    {-62, 18402, 1589975777, 1589961243, 1589990306, -48.23, 7.87},
+    {-62, 18409, 1590580619, 1590566833, 1590594403, -49.50, 6.58},
+    {-62, 18416, 1591185485, 1591172296, 1591198671, -50.46, 5.60},
+    {-62, 18423, 1591790367, 1591777597, 1591803137, -51.10, 4.94},
+    {-62, 18430, 1592395260, 1592382705, 1592407816, -51.41, 4.60},
+    {-62, 18437, 1593000156, 1592987597, 1593012714, -51.40, 4.61},
+    {-62, 18444, 1593605045, 1593592267, 1593617824, -51.09, 4.95},
+    {-62, 18451, 1594209921, 1594196723, 1594223121, -50.44, 5.62},
+    {-62, 18458, 1594814777, 1594800982, 1594828575, -49.48, 6.60},
+    {-62, 18465, 1595419607, 1595405069, 1595434149, -48.22, 7.88},
+    {-62, 18472, 1596024409, 1596009012, 1596039812, -46.68, 9.44},
+    {-62, 18479, 1596629181, 1596612834, 1596645534, -44.90, 11.24},
+    {-62, 18486, 1597233923, 1597216559, 1597251297, -42.89, 13.26},
+    {-62, 18493, 1597838637, 1597820203, 1597857085, -40.69, 15.48},
+    {-62, 18500, 1598443328, 1598423783, 1598462891, -38.32, 17.85},
+    {-62, 18507, 1599048000, 1599027309, 1599068714, -35.82, 20.36},
+    {-62, 18514, 1599652658, 1599630791, 1599674554, -33.22, 22.97},
+    {-62, 18521, 1600257309, 1600234237, 1600280417, -30.54, 25.65},
+    {-62, 18528, 1600861959, 1600837653, 1600886312, -27.83, 28.36},
+    {-62, 18535, 1601466616, 1601441042, 1601492246, -25.11, 31.09},
+    {-62, 18542, 1602071287, 1602044409, 1602098231, -22.41, 33.78},
+    {-62, 18549, 1602675978, 1602647757, 1602704278, -19.77, 36.42},
+    {-62, 18556, 1603280696, 1603251086, 1603310399, -17.22, 38.95},
+    {-62, 18563, 1603885446, 1603854397, 1603916604, -14.81, 41.36},
+    {-62, 18570, 1604490233, 1604457690, 1604522904, -12.56, 43.59},
+    {-62, 18577, 1605095061, 1605060962, 1605129307, -10.52, 45.62},
+    {-62, 18584, 1605699929, 1605664204, 1605735826, -8.72, 47.39},
+    {-62, 18591, 1606304838, 1606267396, 1606342480, -7.21, 48.88},
+    {-62, 18598, 1606909783, 1606870480, 1606949332, -6.02, 50.06},
+    {-62, 18605, 1607514757, 1607473111, 1607556911, -5.16, 50.88},
+    {-62, 18612, 1608119752, -1, -1, -4.68, 51.34},
+    {-62, 18619, 1608724757, -1, -1, -4.59, 51.42},
+    {-62, 18626, 1609329760, -1, -1, -4.92, 51.11},
+    {-60, 18262, 1577880195, 1577842290, 1577918014, -7.02, 53.02},
+    {-60, 18269, 1578485182, 1578448188, 1578522060, -7.80, 52.27},
+    {-60, 18276, 1579090144, 1579054303, 1579125859, -8.93, 51.16},
+    {-60, 18283, 1579695074, 1579660508, 1579729515, -10.39, 49.73},
+    {-60, 18290, 1580299967, 1580266729, 1580333087, -12.14, 47.99},
+    {-60, 18297, 1580904820, 1580872923, 1580936609, -14.16, 45.99},
+    {-60, 18304, 1581509634, 1581479069, 1581540103, -16.40, 43.77},
+    {-60, 18311, 1582114411, 1582085157, 1582143581, -18.82, 41.36},
+    {-60, 18318, 1582719155, 1582691184, 1582747054, -21.38, 38.81},
+    {-60, 18325, 1583323872, 1583297154, 1583350528, -24.05, 36.15},
+    {-60, 18332, 1583928568, 1583903073, 1583954011, -26.78, 33.42},
+    {-60, 18339, 1584533249, 1584508947, 1584557509, -29.55, 30.65},
+    {-60, 18346, 1585137923, 1585114786, 1585161026, -32.30, 27.89},
+    {-60, 18353, 1585742597, 1585720595, 1585764571, -35.02, 25.17},
+    {-60, 18360, 1586347277, 1586326382, 1586368151, -37.67, 22.52},
+    {-60, 18367, 1586951970, 1586932149, 1586971773, -40.21, 19.97},
+    {-60, 18374, 1587556681, 1587537899, 1587575449, -42.61, 17.55},
+    {-60, 18381, 1588161414, 1588143628, 1588179191, -44.85, 15.30},
+    {-60, 18388, 1588766174, 1588749328, 1588783013, -46.88, 13.26},
+    {-60, 18395, 1589370962, 1589354986, 1589386932, -48.69, 11.43},
+    {-60, 18402, 1589975778, 1589960583, 1589990969, -50.23, 9.87},
+    {-60, 18409, 1590580620, 1590566094, 1590595144, -51.50, 8.58},
+    {-60, 18416, 1591185485, 1591171490, 1591199480, -52.46, 7.60},
+    {-60, 18423, 1591790368, 1591776741, 1591803993, -53.10, 6.94},
+    {-60, 18430, 1592395260, 1592381823, 1592408698, -53.41, 6.60},
+    {-60, 18437, 1593000155, 1592986715, 1593013596, -53.40, 6.61},
+    {-60, 18444, 1593605045, 1593591412, 1593618679, -53.09, 6.95},
+    {-60, 18451, 1594209920, 1594195916, 1594223927, -52.44, 7.62},
+    {-60, 18458, 1594814776, 1594800241, 1594829313, -51.48, 8.60},
+    {-60, 18465, 1595419606, 1595404408, 1595434809, -50.22, 9.88},
+    {-60, 18472, 1596024408, 1596008436, 1596040385, -48.68, 11.44},
+    {-60, 18479, 1596629179, 1596612348, 1596646017, -46.90, 13.24},
+    {-60, 18486, 1597233921, 1597216164, 1597251688, -44.89, 15.26},
+    {-60, 18493, 1597838635, 1597819900, 1597857384, -42.69, 17.48},
+    {-60, 18500, 1598443326, 1598423571, 1598463098, -40.32, 19.85},
+    {-60, 18507, 1599047998, 1599027189, 1599068828, -37.82, 22.36},
+    {-60, 18514, 1599652656, 1599630765, 1599674574, -35.22, 24.97},
+    {-60, 18521, 1600257307, 1600234306, 1600280341, -32.54, 27.65},
+    {-60, 18528, 1600861957, 1600837820, 1600886135, -29.83, 30.36},
+    {-60, 18535, 1601466614, 1601441314, 1601491964, -27.11, 33.09},
+    {-60, 18542, 1602071285, 1602044794, 1602097835, -24.41, 35.78},
+    {-60, 18549, 1602675976, 1602648264, 1602703756, -21.77, 38.42},
+    {-60, 18556, 1603280694, 1603251732, 1603309735, -19.22, 40.95},
+    {-60, 18563, 1603885444, 1603855205, 1603915775, -16.81, 43.36},
+    {-60, 18570, 1604490231, 1604458691, 1604521876, -14.56, 45.59},
+    {-60, 18577, 1605095059, 1605062202, 1605128030, -12.52, 47.62},
+    {-60, 18584, 1605699928, 1605665758, 1605734221, -10.72, 49.39},
+    {-60, 18591, 1606304837, 1606269389, 1606340411, -9.21, 50.88},
+    {-60, 18598, 1606909782, 1606873147, 1606946537, -8.02, 52.06},
+    {-60, 18605, 1607514757, 1607477122, 1607552486, -7.16, 52.88},
+    {-60, 18612, 1608119752, 1608081460, 1608158090, -6.68, 53.34},
+    {-60, 18619, 1608724757, 1608686316, 1608763178, -6.59, 53.42},
+    {-60, 18626, 1609329760, 1609291731, 1609367711, -6.92, 53.11},
+    {-50, 18262, 1577880197, 1577848780, 1577911592, -17.02, 63.02},
+    {-50, 18269, 1578485185, 1578454105, 1578516230, -17.80, 62.27},
+    {-50, 18276, 1579090148, 1579059552, 1579120700, -18.93, 61.16},
+    {-50, 18283, 1579695079, 1579665084, 1579725023, -20.39, 59.73},
+    {-50, 18290, 1580299972, 1580270667, 1580329225, -22.14, 57.99},
+    {-50, 18297, 1580904826, 1580876272, 1580933328, -24.16, 55.99},
+    {-50, 18304, 1581509640, 1581481878, 1581537353, -26.40, 53.77},
+    {-50, 18311, 1582114418, 1582087470, 1582141320, -28.82, 51.36},
+    {-50, 18318, 1582719162, 1582693039, 1582745245, -31.38, 48.81},
+    {-50, 18325, 1583323880, 1583298581, 1583349141, -34.05, 46.15},
+    {-50, 18332, 1583928576, 1583904098, 1583953022, -36.78, 43.42},
+    {-50, 18339, 1584533257, 1584509590, 1584556898, -39.55, 40.65},
+    {-50, 18346, 1585137931, 1585115060, 1585160780, -42.30, 37.89},
+    {-50, 18353, 1585742605, 1585720514, 1585764677, -45.02, 35.17},
+    {-50, 18360, 1586347285, 1586325954, 1586368601, -47.67, 32.52},
+    {-50, 18367, 1586951977, 1586931382, 1586972561, -50.21, 29.97},
+    {-50, 18374, 1587556688, 1587536798, 1587576568, -52.61, 27.55},
+    {-50, 18381, 1588161421, 1588142201, 1588180633, -54.85, 25.30},
+    {-50, 18388, 1588766180, 1588747585, 1588784769, -56.88, 23.26},
+    {-50, 18395, 1589370967, 1589352943, 1589388987, -58.69, 21.43},
+    {-50, 18402, 1589975782, 1589958261, 1589993300, -60.23, 19.87},
+    {-50, 18409, 1590580624, 1590563527, 1590597719, -61.50, 18.58},
+    {-50, 18416, 1591185488, 1591168723, 1591202252, -62.46, 17.60},
+    {-50, 18423, 1591790369, 1591773832, 1591806906, -63.10, 16.94},
+    {-50, 18430, 1592395261, 1592378839, 1592411683, -63.41, 16.60},
+    {-50, 18437, 1593000155, 1592983731, 1593016579, -63.40, 16.61},
+    {-50, 18444, 1593605043, 1593588502, 1593621585, -63.09, 16.95},
+    {-50, 18451, 1594209918, 1594193148, 1594226690, -62.44, 17.62},
+    {-50, 18458, 1594814773, 1594797671, 1594831876, -61.48, 18.60},
+    {-50, 18465, 1595419602, 1595402079, 1595437127, -60.22, 19.88},
+    {-50, 18472, 1596024403, 1596006381, 1596042427, -58.68, 21.44},
+    {-50, 18479, 1596629173, 1596610589, 1596647763, -56.90, 23.24},
+    {-50, 18486, 1597233915, 1597214715, 1597253121, -54.89, 25.26},
+    {-50, 18493, 1597838629, 1597818771, 1597858496, -52.69, 27.48},
+    {-50, 18500, 1598443319, 1598422768, 1598463881, -50.32, 29.85},
+    {-50, 18507, 1599047990, 1599026719, 1599069276, -47.82, 32.36},
+    {-50, 18514, 1599652648, 1599630633, 1599674681, -45.22, 34.97},
+    {-50, 18521, 1600257299, 1600234521, 1600280099, -42.54, 37.65},
+    {-50, 18528, 1600861949, 1600838393, 1600885532, -39.83, 40.36},
+    {-50, 18535, 1601466606, 1601442258, 1601490986, -37.11, 43.09},
+    {-50, 18542, 1602071277, 1602046126, 1602096463, -34.41, 45.78},
+    {-50, 18549, 1602675968, 1602650009, 1602701968, -31.77, 48.42},
+    {-50, 18556, 1603280686, 1603253918, 1603307500, -29.22, 50.95},
+    {-50, 18563, 1603885437, 1603857866, 1603913057, -26.81, 53.36},
+    {-50, 18570, 1604490225, 1604461869, 1604518632, -24.56, 55.59},
+    {-50, 18577, 1605095053, 1605065946, 1605124213, -22.52, 57.62},
+    {-50, 18584, 1605699923, 1605670116, 1605729780, -20.72, 59.39},
+    {-50, 18591, 1606304833, 1606274404, 1606335308, -19.21, 60.88},
+    {-50, 18598, 1606909779, 1606878832, 1606940763, -18.02, 62.06},
+    {-50, 18605, 1607514755, 1607483425, 1607546110, -17.16, 62.88},
+    {-50, 18612, 1608119751, 1608088199, 1608151315, -16.68, 63.34},
+    {-50, 18619, 1608724757, 1608693160, 1608756350, -16.59, 63.42},
+    {-50, 18626, 1609329762, 1609298301, 1609361202, -16.92, 63.11},
+    {-40, 18262, 1577880198, 1577851696, 1577908688, -27.02, 73.02},
+    {-40, 18269, 1578485187, 1578456894, 1578513460, -27.80, 72.27},
+    {-40, 18276, 1579090151, 1579062160, 1579118115, -28.93, 71.16},
+    {-40, 18283, 1579695082, 1579667475, 1579722660, -30.39, 69.73},
+    {-40, 18290, 1580299976, 1580272815, 1580327104, -32.14, 67.99},
+    {-40, 18297, 1580904830, 1580878165, 1580931463, -34.16, 65.99},
+    {-40, 18304, 1581509645, 1581483510, 1581535748, -36.40, 63.77},
+    {-40, 18311, 1582114423, 1582088840, 1582139975, -38.82, 61.36},
+    {-40, 18318, 1582719168, 1582694151, 1582744157, -41.38, 58.81},
+    {-40, 18325, 1583323885, 1583299440, 1583348305, -44.05, 56.15},
+    {-40, 18332, 1583928581, 1583904708, 1583952432, -46.78, 53.42},
+    {-40, 18339, 1584533263, 1584509958, 1584556549, -49.55, 50.65},
+    {-40, 18346, 1585137937, 1585115192, 1585160666, -52.30, 47.89},
+    {-40, 18353, 1585742610, 1585720413, 1585764794, -55.02, 45.17},
+    {-40, 18360, 1586347290, 1586325627, 1586368943, -57.67, 42.52},
+    {-40, 18367, 1586951982, 1586930835, 1586973122, -60.21, 39.97},
+    {-40, 18374, 1587556692, 1587536038, 1587577341, -62.61, 37.55},
+    {-40, 18381, 1588161425, 1588141236, 1588181610, -64.85, 35.30},
+    {-40, 18388, 1588766184, 1588746426, 1588785938, -66.88, 33.26},
+    {-40, 18395, 1589370970, 1589351604, 1589390334, -68.69, 31.43},
+    {-40, 18402, 1589975785, 1589956762, 1589994806, -70.23, 29.87},
+    {-40, 18409, 1590580626, 1590561890, 1590599361, -71.50, 28.58},
+    {-40, 18416, 1591185489, 1591166977, 1591204002, -72.46, 27.60},
+    {-40, 18423, 1591790370, 1591772010, 1591808730, -73.10, 26.94},
+    {-40, 18430, 1592395261, 1592376978, 1592413544, -73.41, 26.60},
+    {-40, 18437, 1593000155, 1592981870, 1593018439, -73.40, 26.61},
+    {-40, 18444, 1593605042, 1593586679, 1593623405, -73.09, 26.95},
+    {-40, 18451, 1594209916, 1594191400, 1594228433, -72.44, 27.62},
+    {-40, 18458, 1594814770, 1594796031, 1594833510, -71.48, 28.60},
+    {-40, 18465, 1595419599, 1595400575, 1595438625, -70.22, 29.88},
+    {-40, 18472, 1596024399, 1596005035, 1596043766, -68.68, 31.44},
+    {-40, 18479, 1596629170, 1596609419, 1596648923, -66.90, 33.24},
+    {-40, 18486, 1597233911, 1597213735, 1597254090, -64.89, 35.26},
+    {-40, 18493, 1597838624, 1597817991, 1597859263, -62.69, 37.48},
+    {-40, 18500, 1598443314, 1598422198, 1598464438, -60.32, 39.85},
+    {-40, 18507, 1599047985, 1599026364, 1599069616, -57.82, 42.36},
+    {-40, 18514, 1599652643, 1599630499, 1599674799, -55.22, 44.97},
+    {-40, 18521, 1600257294, 1600234614, 1600279988, -52.54, 47.65},
+    {-40, 18528, 1600861944, 1600838717, 1600885189, -49.83, 50.36},
+    {-40, 18535, 1601466601, 1601442819, 1601490404, -47.11, 53.09},
+    {-40, 18542, 1602071272, 1602046929, 1602095638, -44.41, 55.78},
+    {-40, 18549, 1602675963, 1602651059, 1602700894, -41.77, 58.42},
+    {-40, 18556, 1603280682, 1603255221, 1603306172, -39.22, 60.95},
+    {-40, 18563, 1603885433, 1603859425, 1603911471, -36.81, 63.36},
+    {-40, 18570, 1604490221, 1604463686, 1604516788, -34.56, 65.59},
+    {-40, 18577, 1605095050, 1605068017, 1605122115, -32.52, 67.62},
+    {-40, 18584, 1605699920, 1605672431, 1605727439, -30.72, 69.39},
+    {-40, 18591, 1606304830, 1606276943, 1606332744, -29.21, 70.88},
+    {-40, 18598, 1606909777, 1606881565, 1606938011, -28.02, 72.06},
+    {-40, 18605, 1607514753, 1607486304, 1607543217, -27.16, 72.88},
+    {-40, 18612, 1608119751, 1608091165, 1608148342, -26.68, 73.34},
+    {-40, 18619, 1608724758, 1608696145, 1608753367, -26.59, 73.42},
+    {-40, 18626, 1609329763, 1609301235, 1609358280, -26.92, 73.11},
+    {-30, 18262, 1577880199, 1577853601, 1577906789, -37.02, 83.02},
+    {-30, 18269, 1578485188, 1578458727, 1578511636, -37.80, 82.27},
+    {-30, 18276, 1579090152, 1579063892, 1579116396, -38.93, 81.16},
+    {-30, 18283, 1579695084, 1579669078, 1579721071, -40.39, 79.73},
+    {-30, 18290, 1580299979, 1580274271, 1580325665, -42.14, 77.99},
+    {-30, 18297, 1580904833, 1580879458, 1580930185, -44.16, 75.99},
+    {-30, 18304, 1581509648, 1581484632, 1581534642, -46.40, 73.77},
+    {-30, 18311, 1582114426, 1582089786, 1582139046, -48.82, 71.36},
+    {-30, 18318, 1582719171, 1582694918, 1582743406, -51.38, 68.81},
+    {-30, 18325, 1583323889, 1583300027, 1583347733, -54.05, 66.15},
+    {-30, 18332, 1583928585, 1583905116, 1583952039, -56.78, 63.42},
+    {-30, 18339, 1584533267, 1584510188, 1584556333, -59.55, 60.65},
+    {-30, 18346, 1585137941, 1585115247, 1585160625, -62.30, 57.89},
+    {-30, 18353, 1585742614, 1585720297, 1585764924, -65.02, 55.17},
+    {-30, 18360, 1586347294, 1586325342, 1586369239, -67.67, 52.52},
+    {-30, 18367, 1586951986, 1586930386, 1586973581, -70.21, 49.97},
+    {-30, 18374, 1587556695, 1587535432, 1587577956, -72.61, 47.55},
+    {-30, 18381, 1588161428, 1588140481, 1588182374, -74.85, 45.30},
+    {-30, 18388, 1588766186, 1588745531, 1588786841, -76.88, 43.26},
+    {-30, 18395, 1589370973, 1589350581, 1589391364, -78.69, 41.43},
+    {-30, 18402, 1589975787, 1589955625, 1589995949, -80.23, 39.87},
+    {-30, 18409, 1590580627, 1590560658, 1590600598, -81.50, 38.58},
+    {-30, 18416, 1591185491, 1591165669, 1591205313, -82.46, 37.60},
+    {-30, 18423, 1591790371, 1591770651, 1591810092, -83.10, 36.94},
+    {-30, 18430, 1592395261, 1592375592, 1592414931, -83.41, 36.60},
+    {-30, 18437, 1593000154, 1592980484, 1593019825, -83.40, 36.61},
+    {-30, 18444, 1593605042, 1593585319, 1593624764, -83.09, 36.95},
+    {-30, 18451, 1594209915, 1594190090, 1594229739, -82.44, 37.62},
+    {-30, 18458, 1594814769, 1594794795, 1594834741, -81.48, 38.60},
+    {-30, 18465, 1595419597, 1595399433, 1595439760, -80.22, 39.88},
+    {-30, 18472, 1596024397, 1596004005, 1596044789, -78.68, 41.44},
+    {-30, 18479, 1596629167, 1596608515, 1596649819, -76.90, 43.24},
+    {-30, 18486, 1597233907, 1597212968, 1597254848, -74.89, 45.26},
+    {-30, 18493, 1597838621, 1597817371, 1597859873, -72.69, 47.48},
+    {-30, 18500, 1598443311, 1598421732, 1598464894, -70.32, 49.85},
+    {-30, 18507, 1599047981, 1599026058, 1599069911, -67.82, 52.36},
+    {-30, 18514, 1599652639, 1599630358, 1599674928, -65.22, 54.97},
+    {-30, 18521, 1600257290, 1600234640, 1600279949, -62.54, 57.65},
+    {-30, 18528, 1600861940, 1600838915, 1600884977, -59.83, 60.36},
+    {-30, 18535, 1601466597, 1601443190, 1601490018, -57.11, 63.09},
+    {-30, 18542, 1602071268, 1602047477, 1602095076, -54.41, 65.78},
+    {-30, 18549, 1602675960, 1602651784, 1602700154, -51.77, 68.42},
+    {-30, 18556, 1603280678, 1603256121, 1603305255, -49.22, 70.95},
+    {-30, 18563, 1603885429, 1603860501, 1603910379, -46.81, 73.36},
+    {-30, 18570, 1604490218, 1604464932, 1604515526, -44.56, 75.59},
+    {-30, 18577, 1605095047, 1605069425, 1605120690, -42.52, 77.62},
+    {-30, 18584, 1605699918, 1605673991, 1605725865, -40.72, 79.39},
+    {-30, 18591, 1606304828, 1606278636, 1606331038, -39.21, 80.88},
+    {-30, 18598, 1606909776, 1606883368, 1606936197, -38.02, 82.06},
+    {-30, 18605, 1607514753, 1607488189, 1607541325, -37.16, 82.88},
+    {-30, 18612, 1608119750, 1608093098, 1608146407, -36.68, 83.34},
+    {-30, 18619, 1608724758, 1608698087, 1608751426, -36.59, 83.42},
+    {-30, 18626, 1609329763, 1609303148, 1609356371, -36.92, 83.11},
+    {-20, 18262, 1577880200, 1577855037, 1577905356, -47.02, 86.98},
+    {-20, 18269, 1578485189, 1578460113, 1578510256, -47.80, 87.73},
+    {-20, 18276, 1579090154, 1579065204, 1579115092, -48.93, 88.84},
+    {-20, 18283, 1579695086, 1579670296, 1579719862, -50.39, 89.73},
+    {-20, 18290, 1580299981, 1580275380, 1580324566, -52.14, 87.99},
+    {-20, 18297, 1580904836, 1580880446, 1580929209, -54.16, 85.99},
+    {-20, 18304, 1581509651, 1581485489, 1581533797, -56.40, 83.77},
+    {-20, 18311, 1582114429, 1582090506, 1582138338, -58.82, 81.36},
+    {-20, 18318, 1582719174, 1582695496, 1582742839, -61.38, 78.81},
+    {-20, 18325, 1583323892, 1583300463, 1583347310, -64.05, 76.15},
+    {-20, 18332, 1583928588, 1583905408, 1583951759, -66.78, 73.42},
+    {-20, 18339, 1584533270, 1584510336, 1584556196, -69.55, 70.65},
+    {-20, 18346, 1585137944, 1585115252, 1585160629, -72.30, 67.89},
+    {-20, 18353, 1585742617, 1585720162, 1585765068, -75.02, 65.17},
+    {-20, 18360, 1586347297, 1586325071, 1586369520, -77.67, 62.52},
+    {-20, 18367, 1586951988, 1586929982, 1586973994, -80.21, 59.97},
+    {-20, 18374, 1587556698, 1587534900, 1587578497, -82.61, 57.55},
+    {-20, 18381, 1588161430, 1588139827, 1588183035, -84.85, 55.30},
+    {-20, 18388, 1588766189, 1588744765, 1588787615, -86.88, 53.26},
+    {-20, 18395, 1589370975, 1589349711, 1589392240, -88.69, 51.43},
+    {-20, 18402, 1589975789, 1589954665, 1589996914, -89.97, 49.87},
+    {-20, 18409, 1590580629, 1590559621, 1590601638, -88.66, 48.58},
+    {-20, 18416, 1591185492, 1591164574, 1591206411, -87.66, 47.60},
+    {-20, 18423, 1591790371, 1591769514, 1591811230, -86.97, 46.94},
+    {-20, 18430, 1592395262, 1592374435, 1592416089, -86.62, 46.60},
+    {-20, 18437, 1593000154, 1592979327, 1593020981, -86.62, 46.61},
+    {-20, 18444, 1593605041, 1593584182, 1593625899, -86.99, 46.95},
+    {-20, 18451, 1594209914, 1594188993, 1594230834, -87.68, 47.62},
+    {-20, 18458, 1594814767, 1594793757, 1594835776, -88.68, 48.60},
+    {-20, 18465, 1595419595, 1595398469, 1595440720, -89.98, 49.88},
+    {-20, 18472, 1596024395, 1596003130, 1596045658, -88.68, 51.44},
+    {-20, 18479, 1596629165, 1596607741, 1596650587, -86.90, 53.24},
+    {-20, 18486, 1597233905, 1597212305, 1597255504, -84.89, 55.26},
+    {-20, 18493, 1597838618, 1597816827, 1597860409, -82.69, 57.48},
+    {-20, 18500, 1598443308, 1598421312, 1598465304, -80.32, 59.85},
+    {-20, 18507, 1599047979, 1599025769, 1599070190, -77.82, 62.36},
+    {-20, 18514, 1599652636, 1599630203, 1599675073, -75.22, 64.97},
+    {-20, 18521, 1600257287, 1600234623, 1600279956, -72.55, 67.65},
+    {-20, 18528, 1600861937, 1600839037, 1600884844, -69.83, 70.36},
+    {-20, 18535, 1601466594, 1601443454, 1601489744, -67.11, 73.09},
+    {-20, 18542, 1602071265, 1602047881, 1602094660, -64.41, 75.78},
+    {-20, 18549, 1602675956, 1602652329, 1602699597, -61.77, 78.42},
+    {-20, 18556, 1603280675, 1603256807, 1603304558, -59.22, 80.95},
+    {-20, 18563, 1603885427, 1603861322, 1603909547, -56.81, 83.36},
+    {-20, 18570, 1604490215, 1604465884, 1604514563, -54.56, 85.59},
+    {-20, 18577, 1605095045, 1605070500, 1605119605, -52.52, 87.62},
+    {-20, 18584, 1605699916, 1605675178, 1605724668, -50.72, 89.39},
+    {-20, 18591, 1606304827, 1606279921, 1606329745, -49.21, 89.12},
+    {-20, 18598, 1606909774, 1606884733, 1606934826, -48.02, 87.94},
+    {-20, 18605, 1607514752, 1607489612, 1607539899, -47.16, 87.12},
+    {-20, 18612, 1608119750, 1608094553, 1608144949, -46.68, 86.66},
+    {-20, 18619, 1608724758, 1608699550, 1608749964, -46.59, 86.58},
+    {-20, 18626, 1609329764, 1609304591, 1609354932, -46.92, 86.89},
+    {-10, 18262, 1577880200, 1577856226, 1577904170, -57.02, 76.98},
+    {-10, 18269, 1578485190, 1578461261, 1578509113, -57.80, 77.73},
+    {-10, 18276, 1579090155, 1579066291, 1579114011, -58.93, 78.84},
+    {-10, 18283, 1579695088, 1579671307, 1579718858, -60.39, 80.27},
+    {-10, 18290, 1580299983, 1580276299, 1580323655, -62.14, 82.01},
+    {-10, 18297, 1580904838, 1580881263, 1580928401, -64.16, 84.01},
+    {-10, 18304, 1581509653, 1581486195, 1581533100, -66.40, 86.23},
+    {-10, 18311, 1582114432, 1582091095, 1582137758, -68.82, 88.64},
+    {-10, 18318, 1582719177, 1582695964, 1582742381, -71.38, 88.81},
+    {-10, 18325, 1583323895, 1583300807, 1583346975, -74.05, 86.15},
+    {-10, 18332, 1583928591, 1583905626, 1583951550, -76.78, 83.42},
+    {-10, 18339, 1584533273, 1584510429, 1584556112, -79.55, 80.65},
+    {-10, 18346, 1585137947, 1585115220, 1585160671, -82.30, 77.89},
+    {-10, 18353, 1585742620, 1585720007, 1585765232, -85.02, 75.17},
+    {-10, 18360, 1586347299, 1586324795, 1586369805, -87.67, 72.52},
+    {-10, 18367, 1586951991, 1586929589, 1586974396, -89.85, 69.97},
+    {-10, 18374, 1587556701, 1587534394, 1587579011, -87.72, 67.55},
+    {-10, 18381, 1588161433, 1588139214, 1588183655, -85.46, 65.30},
+    {-10, 18388, 1588766191, 1588744052, 1588788333, -83.39, 63.26},
+    {-10, 18395, 1589370976, 1589348909, 1589393048, -81.56, 61.43},
+    {-10, 18402, 1589975790, 1589953784, 1589997801, -79.97, 59.87},
+    {-10, 18409, 1590580630, 1590558674, 1590602590, -78.66, 58.58},
+    {-10, 18416, 1591185492, 1591163574, 1591207413, -77.66, 57.60},
+    {-10, 18423, 1591790372, 1591768480, 1591812266, -76.97, 56.94},
+    {-10, 18430, 1592395262, 1592373382, 1592417142, -76.62, 56.60},
+    {-10, 18437, 1593000154, 1592978273, 1593022034, -76.62, 56.61},
+    {-10, 18444, 1593605040, 1593583146, 1593626933, -76.99, 56.95},
+    {-10, 18451, 1594209913, 1594187992, 1594231832, -77.68, 57.62},
+    {-10, 18458, 1594814766, 1594792806, 1594836723, -78.68, 58.60},
+    {-10, 18465, 1595419594, 1595397583, 1595441600, -79.99, 59.88},
+    {-10, 18472, 1596024393, 1596002322, 1596046460, -81.56, 61.44},
+    {-10, 18479, 1596629163, 1596607021, 1596651300, -83.38, 63.24},
+    {-10, 18486, 1597233903, 1597211683, 1597256119, -85.42, 65.26},
+    {-10, 18493, 1597838616, 1597816309, 1597860919, -87.64, 67.48},
+    {-10, 18500, 1598443305, 1598420906, 1598465703, -89.94, 69.85},
+    {-10, 18507, 1599047976, 1599025477, 1599070474, -87.82, 72.36},
+    {-10, 18514, 1599652633, 1599630030, 1599675237, -85.22, 74.97},
+    {-10, 18521, 1600257284, 1600234571, 1600279999, -82.54, 77.65},
+    {-10, 18528, 1600861934, 1600839107, 1600884765, -79.83, 80.36},
+    {-10, 18535, 1601466591, 1601443647, 1601489540, -77.11, 83.09},
+    {-10, 18542, 1602071262, 1602048199, 1602094333, -74.41, 85.78},
+    {-10, 18549, 1602675954, 1602652769, 1602699147, -71.77, 88.42},
+    {-10, 18556, 1603280673, 1603257367, 1603303988, -69.22, 89.05},
+    {-10, 18563, 1603885424, 1603861999, 1603908860, -66.81, 86.64},
+    {-10, 18570, 1604490213, 1604466672, 1604513766, -64.56, 84.41},
+    {-10, 18577, 1605095043, 1605071392, 1605118705, -62.52, 82.38},
+    {-10, 18584, 1605699914, 1605676163, 1605723675, -60.72, 80.61},
+    {-10, 18591, 1606304826, 1606280987, 1606328673, -59.21, 79.12},
+    {-10, 18598, 1606909773, 1606885864, 1606933690, -58.02, 77.94},
+    {-10, 18605, 1607514751, 1607490790, 1607538717, -57.16, 77.12},
+    {-10, 18612, 1608119750, 1608095759, 1608143742, -56.68, 76.66},
+    {-10, 18619, 1608724758, 1608700761, 1608748754, -56.59, 76.58},
+    {-10, 18626, 1609329765, 1609305785, 1609353740, -56.92, 76.89},
+    {0, 18262, 1577880201, 1577857288, 1577903111, -67.02, 66.98},
+    {0, 18269, 1578485191, 1578462285, 1578508092, -67.80, 67.73},
+    {0, 18276, 1579090156, 1579067261, 1579113046, -68.93, 68.84},
+    {0, 18283, 1579695089, 1579672206, 1579717965, -70.39, 70.27},
+    {0, 18290, 1580299984, 1580277116, 1580322845, -72.14, 72.01},
+    {0, 18297, 1580904840, 1580881986, 1580927686, -74.16, 74.01},
+    {0, 18304, 1581509655, 1581486816, 1581532487, -76.40, 76.23},
+    {0, 18311, 1582114434, 1582091608, 1582137253, -78.82, 78.64},
+    {0, 18318, 1582719179, 1582696365, 1582741989, -81.38, 81.19},
+    {0, 18325, 1583323897, 1583301092, 1583346699, -84.05, 83.85},
+    {0, 18332, 1583928594, 1583905795, 1583951391, -86.78, 86.58},
+    {0, 18339, 1584533275, 1584510480, 1584556071, -89.54, 89.35},
+    {0, 18346, 1585137949, 1585115154, 1585160746, -88.09, 87.89},
+    {0, 18353, 1585742623, 1585719824, 1585765424, -85.36, 85.17},
+    {0, 18360, 1586347302, 1586324498, 1586370110, -82.70, 82.52},
+    {0, 18367, 1586951993, 1586929181, 1586974811, -80.14, 79.97},
+    {0, 18374, 1587556703, 1587533880, 1587579532, -77.72, 77.55},
+    {0, 18381, 1588161435, 1588138600, 1588184277, -75.46, 75.30},
+    {0, 18388, 1588766192, 1588743344, 1588789048, -73.39, 73.26},
+    {0, 18395, 1589370978, 1589348116, 1589393848, -71.56, 71.43},
+    {0, 18402, 1589975791, 1589952915, 1589998674, -69.97, 69.87},
+    {0, 18409, 1590580631, 1590557743, 1590603525, -68.66, 68.58},
+    {0, 18416, 1591185493, 1591162594, 1591208396, -67.66, 67.60},
+    {0, 18423, 1591790372, 1591767466, 1591813282, -66.97, 66.94},
+    {0, 18430, 1592395262, 1592372351, 1592418174, -66.62, 66.60},
+    {0, 18437, 1593000154, 1592977242, 1593023064, -66.62, 66.61},
+    {0, 18444, 1593605040, 1593582131, 1593627946, -66.99, 66.95},
+    {0, 18451, 1594209913, 1594187010, 1594232811, -67.68, 67.62},
+    {0, 18458, 1594814765, 1594791872, 1594837653, -68.68, 68.60},
+    {0, 18465, 1595419593, 1595396711, 1595442468, -69.99, 69.88},
+    {0, 18472, 1596024392, 1596001523, 1596047254, -71.56, 71.44},
+    {0, 18479, 1596629161, 1596606306, 1596652009, -73.38, 73.24},
+    {0, 18486, 1597233901, 1597211059, 1597256735, -75.42, 75.26},
+    {0, 18493, 1597838614, 1597815785, 1597861436, -77.64, 77.48},
+    {0, 18500, 1598443303, 1598420486, 1598466115, -80.03, 79.85},
+    {0, 18507, 1599047973, 1599025166, 1599070777, -82.55, 82.36},
+    {0, 18514, 1599652631, 1599629830, 1599675428, -85.16, 84.97},
+    {0, 18521, 1600257281, 1600234485, 1600280076, -87.84, 87.65},
+    {0, 18528, 1600861932, 1600839137, 1600884726, -89.82, 89.64},
+    {0, 18535, 1601466589, 1601443793, 1601489386, -87.11, 86.91},
+    {0, 18542, 1602071260, 1602048460, 1602094063, -84.41, 84.22},
+    {0, 18549, 1602675951, 1602653144, 1602698763, -81.77, 81.58},
+    {0, 18556, 1603280670, 1603257853, 1603303493, -79.22, 79.05},
+    {0, 18563, 1603885422, 1603862593, 1603908258, -76.81, 76.64},
+    {0, 18570, 1604490211, 1604467369, 1604513061, -74.56, 74.41},
+    {0, 18577, 1605095041, 1605072184, 1605117906, -72.52, 72.38},
+    {0, 18584, 1605699912, 1605677040, 1605722792, -70.72, 70.61},
+    {0, 18591, 1606304824, 1606281938, 1606327717, -69.21, 69.12},
+    {0, 18598, 1606909772, 1606886874, 1606932676, -68.02, 67.94},
+    {0, 18605, 1607514751, 1607491842, 1607537662, -67.16, 67.12},
+    {0, 18612, 1608119749, 1608096835, 1608142665, -66.68, 66.66},
+    {0, 18619, 1608724758, 1608701842, 1608747674, -66.59, 66.58},
+    {0, 18626, 1609329765, 1609306851, 1609352676, -66.92, 66.89},
+    {10, 18262, 1577880201, 1577858301, 1577902100, -77.02, 56.98},
+    {10, 18269, 1578485192, 1578463262, 1578507119, -77.80, 57.73},
+    {10, 18276, 1579090158, 1579068184, 1579112127, -78.93, 58.84},
+    {10, 18283, 1579695091, 1579673061, 1579717116, -80.39, 60.27},
+    {10, 18290, 1580299986, 1580277889, 1580322079, -82.14, 62.01},
+    {10, 18297, 1580904842, 1580882667, 1580927012, -84.16, 64.01},
+    {10, 18304, 1581509658, 1581487397, 1581531915, -86.40, 66.23},
+    {10, 18311, 1582114436, 1582092082, 1582136788, -88.82, 68.64},
+    {10, 18318, 1582719182, 1582696727, 1582741635, -88.99, 71.19},
+    {10, 18325, 1583323900, 1583301340, 1583346460, -86.34, 73.85},
+    {10, 18332, 1583928596, 1583905926, 1583951268, -83.61, 76.58},
+    {10, 18339, 1584533278, 1584510493, 1584556066, -80.85, 79.35},
+    {10, 18346, 1585137952, 1585115050, 1585160859, -78.09, 82.11},
+    {10, 18353, 1585742625, 1585719604, 1585765652, -75.36, 84.83},
+    {10, 18360, 1586347304, 1586324163, 1586370453, -72.70, 87.48},
+    {10, 18367, 1586951996, 1586928735, 1586975266, -70.14, 89.97},
+    {10, 18374, 1587556705, 1587533327, 1587580094, -67.72, 87.55},
+    {10, 18381, 1588161437, 1588137944, 1588184940, -65.46, 85.30},
+    {10, 18388, 1588766194, 1588742593, 1588789806, -63.39, 83.26},
+    {10, 18395, 1589370980, 1589347278, 1589394691, -61.56, 81.43},
+    {10, 18402, 1589975793, 1589952002, 1589999593, -59.97, 79.87},
+    {10, 18409, 1590580632, 1590556765, 1590604507, -58.66, 78.58},
+    {10, 18416, 1591185494, 1591161567, 1591209427, -57.66, 77.60},
+    {10, 18423, 1591790373, 1591766405, 1591814345, -56.97, 76.94},
+    {10, 18430, 1592395262, 1592371272, 1592419253, -56.62, 76.60},
+    {10, 18437, 1593000154, 1592976163, 1593024143, -56.62, 76.61},
+    {10, 18444, 1593605039, 1593581068, 1593629007, -56.99, 76.95},
+    {10, 18451, 1594209912, 1594185981, 1594233837, -57.68, 77.62},
+    {10, 18458, 1594814764, 1594790891, 1594838629, -58.68, 78.60},
+    {10, 18465, 1595419591, 1595395793, 1595443381, -59.99, 79.88},
+    {10, 18472, 1596024390, 1596000679, 1596048090, -61.56, 81.44},
+    {10, 18479, 1596629159, 1596605547, 1596652760, -63.38, 83.24},
+    {10, 18486, 1597233899, 1597210394, 1597257393, -65.42, 85.26},
+    {10, 18493, 1597838611, 1597815220, 1597861993, -67.64, 87.48},
+    {10, 18500, 1598443301, 1598420026, 1598466566, -70.03, 89.85},
+    {10, 18507, 1599047971, 1599024816, 1599071118, -72.55, 87.64},
+    {10, 18514, 1599652628, 1599629593, 1599675657, -75.16, 85.03},
+    {10, 18521, 1600257279, 1600234362, 1600280190, -77.84, 82.35},
+    {10, 18528, 1600861929, 1600839130, 1600884725, -80.56, 79.64},
+    {10, 18535, 1601466586, 1601443901, 1601489269, -83.28, 76.91},
+    {10, 18542, 1602071257, 1602048683, 1602093831, -85.97, 74.22},
+    {10, 18549, 1602675949, 1602653481, 1602698418, -88.60, 71.58},
+    {10, 18556, 1603280668, 1603258301, 1603303037, -89.22, 69.05},
+    {10, 18563, 1603885420, 1603863147, 1603907696, -86.81, 66.64},
+    {10, 18570, 1604490209, 1604468024, 1604512399, -84.56, 64.41},
+    {10, 18577, 1605095039, 1605072933, 1605117150, -82.52, 62.38},
+    {10, 18584, 1605699911, 1605677873, 1605721953, -80.72, 60.61},
+    {10, 18591, 1606304823, 1606282843, 1606326807, -79.21, 59.12},
+    {10, 18598, 1606909772, 1606887837, 1606931710, -78.02, 57.94},
+    {10, 18605, 1607514750, 1607492847, 1607536656, -77.16, 57.12},
+    {10, 18612, 1608119749, 1608097863, 1608141636, -76.68, 56.66},
+    {10, 18619, 1608724758, 1608702874, 1608746642, -76.59, 56.58},
+    {10, 18626, 1609329765, 1609307869, 1609351660, -76.92, 56.89},
+    {20, 18262, 1577880202, 1577859335, 1577901067, -87.02, 46.98},
+    {20, 18269, 1578485193, 1578464258, 1578506126, -87.80, 47.73},
+    {20, 18276, 1579090159, 1579069123, 1579111193, -88.93, 48.84},
+    {20, 18283, 1579695092, 1579673927, 1579716255, -89.83, 50.27},
+    {20, 18290, 1580299988, 1580278669, 1580321305, -88.13, 52.01},
+    {20, 18297, 1580904844, 1580883350, 1580926336, -86.14, 54.01},
+    {20, 18304, 1581509660, 1581487973, 1581531346, -83.94, 56.23},
+    {20, 18311, 1582114439, 1582092545, 1582136333, -81.54, 58.64},
+    {20, 18318, 1582719185, 1582697073, 1582741298, -78.99, 61.19},
+    {20, 18325, 1583323903, 1583301563, 1583346245, -76.34, 63.85},
+    {20, 18332, 1583928599, 1583906026, 1583951177, -73.61, 66.58},
+    {20, 18339, 1584533281, 1584510469, 1584556100, -70.85, 69.35},
+    {20, 18346, 1585137955, 1585114901, 1585161017, -68.09, 72.11},
+    {20, 18353, 1585742628, 1585719331, 1585765936, -65.36, 74.83},
+    {20, 18360, 1586347307, 1586323767, 1586370859, -62.70, 77.48},
+    {20, 18367, 1586951998, 1586928219, 1586975791, -60.14, 80.03},
+    {20, 18374, 1587556707, 1587532695, 1587580735, -57.72, 82.45},
+    {20, 18381, 1588161439, 1588137201, 1588185692, -55.46, 84.70},
+    {20, 18388, 1588766196, 1588741747, 1588790661, -53.39, 86.74},
+    {20, 18395, 1589370981, 1589346337, 1589395640, -51.56, 88.57},
+    {20, 18402, 1589975794, 1589950977, 1590000624, -49.97, 89.87},
+    {20, 18409, 1590580633, 1590555670, 1590605608, -48.66, 88.58},
+    {20, 18416, 1591185495, 1591160417, 1591210581, -47.66, 87.60},
+    {20, 18423, 1591790373, 1591765216, 1591815536, -46.97, 86.94},
+    {20, 18430, 1592395262, 1592370063, 1592420463, -46.62, 86.60},
+    {20, 18437, 1593000153, 1592974953, 1593025352, -46.62, 86.61},
+    {20, 18444, 1593605039, 1593579878, 1593630195, -46.99, 86.95},
+    {20, 18451, 1594209911, 1594184827, 1594234987, -47.68, 87.62},
+    {20, 18458, 1594814763, 1594789791, 1594839724, -48.68, 88.60},
+    {20, 18465, 1595419590, 1595394762, 1595444405, -49.99, 89.88},
+    {20, 18472, 1596024388, 1595999731, 1596049032, -51.56, 88.56},
+    {20, 18479, 1596629157, 1596604692, 1596653608, -53.38, 86.76},
+    {20, 18486, 1597233897, 1597209640, 1597258138, -55.42, 84.74},
+    {20, 18493, 1597838609, 1597814575, 1597862629, -57.64, 82.52},
+    {20, 18500, 1598443298, 1598419495, 1598467087, -60.03, 80.15},
+    {20, 18507, 1599047968, 1599024403, 1599071522, -62.55, 77.64},
+    {20, 18514, 1599652625, 1599629301, 1599675940, -65.16, 75.03},
+    {20, 18521, 1600257276, 1600234192, 1600280351, -67.84, 72.35},
+    {20, 18528, 1600861926, 1600839083, 1600884762, -70.56, 69.64},
+    {20, 18535, 1601466583, 1601443977, 1601489184, -73.28, 66.91},
+    {20, 18542, 1602071254, 1602048881, 1602093624, -75.97, 64.22},
+    {20, 18549, 1602675946, 1602653800, 1602698091, -78.60, 61.58},
+    {20, 18556, 1603280665, 1603258737, 1603302593, -81.13, 59.05},
+    {20, 18563, 1603885417, 1603863697, 1603907139, -83.53, 56.64},
+    {20, 18570, 1604490207, 1604468680, 1604511735, -85.75, 54.41},
+    {20, 18577, 1605095037, 1605073688, 1605116389, -87.75, 52.38},
+    {20, 18584, 1605699909, 1605678717, 1605721104, -89.51, 50.61},
+    {20, 18591, 1606304822, 1606283763, 1606325883, -89.21, 49.12},
+    {20, 18598, 1606909770, 1606888818, 1606930725, -88.02, 47.94},
+    {20, 18605, 1607514749, 1607493872, 1607535628, -87.16, 47.12},
+    {20, 18612, 1608119749, 1608098913, 1608140585, -86.68, 46.66},
+    {20, 18619, 1608724758, 1608703929, 1608745587, -86.59, 46.58},
+    {20, 18626, 1609329766, 1609308908, 1609350623, -86.92, 46.89},
+    {30, 18262, 1577880203, 1577860471, 1577899934, -83.06, 36.98},
+    {30, 18269, 1578485194, 1578465348, 1578505039, -82.34, 37.73},
+    {30, 18276, 1579090161, 1579070149, 1579110172, -81.25, 38.84},
+    {30, 18283, 1579695094, 1579674869, 1579715319, -79.84, 40.27},
+    {30, 18290, 1580299990, 1580279512, 1580320468, -78.13, 42.01},
+    {30, 18297, 1580904846, 1580884082, 1580925612, -76.14, 44.01},
+    {30, 18304, 1581509663, 1581488585, 1581530743, -73.94, 46.23},
+    {30, 18311, 1582114442, 1582093029, 1582135858, -71.54, 48.64},
+    {30, 18318, 1582719188, 1582697422, 1582740958, -68.99, 51.19},
+    {30, 18325, 1583323906, 1583301776, 1583346043, -66.34, 53.85},
+    {30, 18332, 1583928602, 1583906098, 1583951116, -63.61, 56.58},
+    {30, 18339, 1584533284, 1584510399, 1584556180, -60.85, 59.35},
+    {30, 18346, 1585137958, 1585114688, 1585161241, -58.09, 62.11},
+    {30, 18353, 1585742631, 1585718976, 1585766302, -55.36, 64.83},
+    {30, 18360, 1586347310, 1586323272, 1586371366, -52.70, 67.48},
+    {30, 18367, 1586952001, 1586927585, 1586976437, -50.14, 70.03},
+    {30, 18374, 1587556710, 1587531925, 1587581516, -47.72, 72.45},
+    {30, 18381, 1588161442, 1588136302, 1588186602, -45.46, 74.70},
+    {30, 18388, 1588766199, 1588740725, 1588791693, -43.39, 76.74},
+    {30, 18395, 1589370983, 1589345202, 1589396784, -41.56, 78.57},
+    {30, 18402, 1589975796, 1589949742, 1590001868, -39.97, 80.13},
+    {30, 18409, 1590580635, 1590554349, 1590606936, -38.66, 81.42},
+    {30, 18416, 1591185496, 1591159028, 1591211975, -37.66, 82.40},
+    {30, 18423, 1591790374, 1591763780, 1591816975, -36.97, 83.06},
+    {30, 18430, 1592395262, 1592368604, 1592421924, -36.62, 83.40},
+    {30, 18437, 1593000153, 1592973493, 1593026811, -36.62, 83.39},
+    {30, 18444, 1593605038, 1593578440, 1593631629, -36.99, 83.05},
+    {30, 18451, 1594209910, 1594183434, 1594236374, -37.68, 82.38},
+    {30, 18458, 1594814762, 1594788465, 1594841043, -38.68, 81.40},
+    {30, 18465, 1595419588, 1595393519, 1595445639, -39.99, 80.12},
+    {30, 18472, 1596024386, 1595998587, 1596050166, -41.56, 78.56},
+    {30, 18479, 1596629155, 1596603659, 1596654630, -43.38, 76.76},
+    {30, 18486, 1597233894, 1597208728, 1597259039, -45.42, 74.74},
+    {30, 18493, 1597838606, 1597813790, 1597863402, -47.64, 72.52},
+    {30, 18500, 1598443295, 1598418844, 1598467728, -50.03, 70.15},
+    {30, 18507, 1599047965, 1599023888, 1599072025, -52.55, 67.64},
+    {30, 18514, 1599652622, 1599628924, 1599676305, -55.16, 65.03},
+    {30, 18521, 1600257273, 1600233956, 1600280576, -57.84, 62.35},
+    {30, 18528, 1600861923, 1600838987, 1600884847, -60.56, 59.64},
+    {30, 18535, 1601466580, 1601444022, 1601489129, -63.28, 56.91},
+    {30, 18542, 1602071251, 1602049065, 1602093431, -65.97, 54.22},
+    {30, 18549, 1602675943, 1602654120, 1602697761, -68.60, 51.58},
+    {30, 18556, 1603280662, 1603259190, 1603302131, -71.13, 49.05},
+    {30, 18563, 1603885415, 1603864278, 1603906549, -73.53, 46.64},
+    {30, 18570, 1604490204, 1604469383, 1604511025, -75.75, 44.41},
+    {30, 18577, 1605095035, 1605074503, 1605115567, -77.75, 42.38},
+    {30, 18584, 1605699907, 1605679634, 1605720181, -79.51, 40.61},
+    {30, 18591, 1606304820, 1606284767, 1606324874, -80.98, 39.12},
+    {30, 18598, 1606909769, 1606889892, 1606929647, -82.13, 37.94},
+    {30, 18605, 1607514748, 1607494997, 1607534501, -82.93, 37.12},
+    {30, 18612, 1608119748, 1608100067, 1608139430, -83.36, 36.66},
+    {30, 18619, 1608724758, 1608705088, 1608744428, -83.43, 36.58},
+    {30, 18626, 1609329767, 1609310049, 1609349483, -83.15, 36.89},
+    {40, 18262, 1577880203, 1577861829, 1577898577, -73.06, 26.98},
+    {40, 18269, 1578485195, 1578466650, 1578503741, -72.34, 27.73},
+    {40, 18276, 1579090162, 1579071367, 1579108958, -71.26, 28.84},
+    {40, 18283, 1579695097, 1579675983, 1579714211, -69.84, 30.27},
+    {40, 18290, 1580299993, 1580280502, 1580319486, -68.13, 32.01},
+    {40, 18297, 1580904849, 1580884934, 1580924768, -66.14, 34.01},
+    {40, 18304, 1581509666, 1581489287, 1581530050, -63.94, 36.23},
+    {40, 18311, 1582114445, 1582093573, 1582135324, -61.54, 38.64},
+    {40, 18318, 1582719191, 1582697803, 1582740589, -58.99, 41.19},
+    {40, 18325, 1583323910, 1583301988, 1583345843, -56.34, 43.85},
+    {40, 18332, 1583928606, 1583906138, 1583951088, -53.61, 46.58},
+    {40, 18339, 1584533288, 1584510265, 1584556328, -50.85, 49.35},
+    {40, 18346, 1585137962, 1585114379, 1585161564, -48.09, 52.11},
+    {40, 18353, 1585742635, 1585718491, 1585766801, -45.36, 54.83},
+    {40, 18360, 1586347314, 1586322611, 1586372042, -42.70, 57.48},
+    {40, 18367, 1586952005, 1586926749, 1586977289, -40.14, 60.03},
+    {40, 18374, 1587556714, 1587530917, 1587582540, -37.72, 62.45},
+    {40, 18381, 1588161445, 1588135126, 1588187794, -35.46, 64.70},
+    {40, 18388, 1588766201, 1588739388, 1588793046, -33.39, 66.74},
+    {40, 18395, 1589370986, 1589343714, 1589398287, -31.56, 68.57},
+    {40, 18402, 1589975798, 1589948117, 1590003506, -29.97, 70.13},
+    {40, 18409, 1590580636, 1590552606, 1590608690, -28.66, 71.42},
+    {40, 18416, 1591185497, 1591157191, 1591213821, -27.66, 72.40},
+    {40, 18423, 1591790375, 1591761877, 1591818884, -26.97, 73.06},
+    {40, 18430, 1592395263, 1592366666, 1592423863, -26.62, 73.40},
+    {40, 18437, 1593000153, 1592971554, 1593028748, -26.62, 73.39},
+    {40, 18444, 1593605038, 1593576533, 1593633531, -26.99, 73.05},
+    {40, 18451, 1594209909, 1594181591, 1594238209, -27.68, 72.38},
+    {40, 18458, 1594814760, 1594786713, 1594842784, -28.68, 71.40},
+    {40, 18465, 1595419586, 1595391882, 1595447263, -29.99, 70.12},
+    {40, 18472, 1596024384, 1595997084, 1596051654, -31.56, 68.56},
+    {40, 18479, 1596629152, 1596602305, 1596655969, -33.38, 66.76},
+    {40, 18486, 1597233891, 1597207533, 1597260219, -35.42, 64.74},
+    {40, 18493, 1597838603, 1597812761, 1597864416, -37.64, 62.52},
+    {40, 18500, 1598443292, 1598417984, 1598468571, -40.03, 60.15},
+    {40, 18507, 1599047962, 1599023201, 1599072697, -42.55, 57.64},
+    {40, 18514, 1599652619, 1599628412, 1599676803, -45.16, 55.03},
+    {40, 18521, 1600257269, 1600233617, 1600280900, -47.84, 52.35},
+    {40, 18528, 1600861919, 1600838822, 1600884999, -50.56, 49.64},
+    {40, 18535, 1601466576, 1601444029, 1601489109, -53.28, 46.91},
+    {40, 18542, 1602071247, 1602049242, 1602093241, -55.97, 44.22},
+    {40, 18549, 1602675939, 1602654464, 1602697406, -58.60, 41.58},
+    {40, 18556, 1603280659, 1603259698, 1603301613, -61.13, 39.05},
+    {40, 18563, 1603885411, 1603864943, 1603905874, -63.53, 36.64},
+    {40, 18570, 1604490201, 1604470199, 1604510200, -65.75, 34.41},
+    {40, 18577, 1605095032, 1605075459, 1605114603, -67.75, 32.38},
+    {40, 18584, 1605699905, 1605680717, 1605719092, -69.51, 30.61},
+    {40, 18591, 1606304818, 1606285960, 1606323676, -70.98, 29.12},
+    {40, 18598, 1606909768, 1606891174, 1606928362, -72.13, 27.94},
+    {40, 18605, 1607514748, 1607496342, 1607533153, -72.93, 27.12},
+    {40, 18612, 1608119748, 1608101449, 1608138047, -73.36, 26.66},
+    {40, 18619, 1608724759, 1608706477, 1608743040, -73.43, 26.58},
+    {40, 18626, 1609329767, 1609311415, 1609348120, -73.15, 26.89},
+    {50, 18262, 1577880204, 1577863649, 1577896761, -63.06, 16.98},
+    {50, 18269, 1578485197, 1578468386, 1578502010, -62.34, 17.73},
+    {50, 18276, 1579090165, 1579072983, 1579107349, -61.26, 18.84},
+    {50, 18283, 1579695100, 1579677448, 1579712754, -59.84, 20.27},
+    {50, 18290, 1580299997, 1580281793, 1580318205, -58.13, 22.01},
+    {50, 18297, 1580904854, 1580886032, 1580923681, -56.14, 24.01},
+    {50, 18304, 1581509671, 1581490180, 1581529170, -53.94, 26.23},
+    {50, 18311, 1582114450, 1582094250, 1582134661, -51.54, 28.64},
+    {50, 18318, 1582719196, 1582698258, 1582740148, -48.99, 31.19},
+    {50, 18325, 1583323915, 1583302216, 1583345631, -46.34, 33.85},
+    {50, 18332, 1583928612, 1583906136, 1583951108, -43.61, 36.58},
+    {50, 18339, 1584533293, 1584510028, 1584556583, -40.85, 39.35},
+    {50, 18346, 1585137967, 1585113904, 1585162059, -38.09, 42.11},
+    {50, 18353, 1585742640, 1585717775, 1585767539, -35.36, 44.83},
+    {50, 18360, 1586347319, 1586321649, 1586373027, -32.70, 47.48},
+    {50, 18367, 1586952010, 1586925539, 1586978522, -30.14, 50.03},
+    {50, 18374, 1587556718, 1587529457, 1587584025, -27.72, 52.45},
+    {50, 18381, 1588161449, 1588133415, 1588189531, -25.46, 54.70},
+    {50, 18388, 1588766205, 1588737429, 1588795031, -23.39, 56.74},
+    {50, 18395, 1589370989, 1589341515, 1589400512, -21.56, 58.57},
+    {50, 18402, 1589975801, 1589945692, 1590005955, -19.97, 60.13},
+    {50, 18409, 1590580638, 1590549980, 1590611337, -18.66, 61.42},
+    {50, 18416, 1591185499, 1591154399, 1591216630, -17.66, 62.40},
+    {50, 18423, 1591790376, 1591758964, 1591821807, -16.97, 63.06},
+    {50, 18430, 1592395263, 1592363688, 1592426845, -16.62, 63.40},
+    {50, 18437, 1593000153, 1592968573, 1593031725, -16.62, 63.39},
+    {50, 18444, 1593605037, 1593573611, 1593636442, -16.99, 63.05},
+    {50, 18451, 1594209907, 1594178785, 1594240998, -17.68, 62.38},
+    {50, 18458, 1594814758, 1594784069, 1594845407, -18.68, 61.40},
+    {50, 18465, 1595419583, 1595389436, 1595449685, -19.99, 60.12},
+    {50, 18472, 1596024381, 1595994860, 1596053852, -21.56, 58.56},
+    {50, 18479, 1596629148, 1596600318, 1596657930, -23.38, 56.76},
+    {50, 18486, 1597233887, 1597205791, 1597261934, -25.42, 54.74},
+    {50, 18493, 1597838599, 1597811268, 1597865884, -27.64, 52.52},
+    {50, 18500, 1598443287, 1598416740, 1598469792, -30.03, 50.15},
+    {50, 18507, 1599047957, 1599022202, 1599073673, -32.55, 47.64},
+    {50, 18514, 1599652614, 1599627656, 1599677538, -35.16, 45.03},
+    {50, 18521, 1600257264, 1600233101, 1600281397, -37.84, 42.35},
+    {50, 18528, 1600861914, 1600838542, 1600885261, -40.56, 39.64},
+    {50, 18535, 1601466571, 1601443981, 1601489140, -43.28, 36.91},
+    {50, 18542, 1602071242, 1602049423, 1602093044, -45.97, 34.22},
+    {50, 18549, 1602675934, 1602654871, 1602696984, -48.60, 31.58},
+    {50, 18556, 1603280654, 1603260326, 1603300972, -51.13, 29.05},
+    {50, 18563, 1603885407, 1603865786, 1603905019, -53.53, 26.64},
+    {50, 18570, 1604490197, 1604471248, 1604509140, -55.75, 24.41},
+    {50, 18577, 1605095029, 1605076703, 1605113349, -57.75, 22.38},
+    {50, 18584, 1605699902, 1605682139, 1605717661, -59.51, 20.61},
+    {50, 18591, 1606304816, 1606287539, 1606322090, -60.98, 19.12},
+    {50, 18598, 1606909766, 1606892881, 1606926649, -62.13, 17.94},
+    {50, 18605, 1607514746, 1607498143, 1607531349, -62.93, 17.12},
+    {50, 18612, 1608119748, 1608103303, 1608136192, -63.36, 16.66},
+    {50, 18619, 1608724759, 1608708342, 1608741176, -63.43, 16.58},
+    {50, 18626, 1609329768, 1609313245, 1609346292, -63.15, 16.89},
+    {60, 18262, 1577880206, 1577866553, 1577893861, -53.06, 6.98},
+    {60, 18269, 1578485200, 1578471132, 1578499270, -52.34, 7.73},
+    {60, 18276, 1579090169, 1579075509, 1579104832, -51.26, 8.84},
+    {60, 18283, 1579695104, 1579679707, 1579710506, -49.84, 10.27},
+    {60, 18290, 1580300002, 1580283752, 1580316258, -48.13, 12.01},
+    {60, 18297, 1580904860, 1580887672, 1580922057, -46.14, 14.01},
+    {60, 18304, 1581509677, 1581491487, 1581527880, -43.94, 16.23},
+    {60, 18311, 1582114458, 1582095219, 1582133712, -41.54, 18.64},
+    {60, 18318, 1582719204, 1582698883, 1582739546, -38.99, 21.19},
+    {60, 18325, 1583323923, 1583302493, 1583345378, -36.34, 23.85},
+    {60, 18332, 1583928620, 1583906059, 1583951212, -33.61, 26.58},
+    {60, 18339, 1584533301, 1584509591, 1584557050, -30.85, 29.35},
+    {60, 18346, 1585137975, 1585113097, 1585162900, -28.09, 32.11},
+    {60, 18353, 1585742648, 1585716582, 1585768769, -25.36, 34.83},
+    {60, 18360, 1586347326, 1586320055, 1586374663, -22.70, 37.48},
+    {60, 18367, 1586952017, 1586923520, 1586980589, -20.14, 40.03},
+    {60, 18374, 1587556725, 1587526984, 1587586551, -17.72, 42.45},
+    {60, 18381, 1588161455, 1588130455, 1588192551, -15.46, 44.70},
+    {60, 18388, 1588766211, 1588733942, 1588798585, -13.39, 46.74},
+    {60, 18395, 1589370994, 1589337459, 1589404643, -11.56, 48.57},
+    {60, 18402, 1589975805, 1589941028, 1590010701, -9.97, 50.13},
+    {60, 18409, 1590580642, 1590544681, 1590616721, -8.66, 51.42},
+    {60, 18416, 1591185501, 1591148474, 1591222635, -7.66, 52.40},
+    {60, 18423, 1591790377, 1591752500, 1591828333, -6.97, 53.06},
+    {60, 18430, 1592395264, 1592356888, 1592433668, -6.62, 53.40},
+    {60, 18437, 1593000152, 1592961755, 1593038519, -6.62, 53.39},
+    {60, 18444, 1593605035, 1593567098, 1593642894, -6.99, 53.05},
+    {60, 18451, 1594209905, 1594172794, 1594246909, -7.68, 52.38},
+    {60, 18458, 1594814754, 1594778696, 1594850695, -8.68, 51.40},
+    {60, 18465, 1595419579, 1595384697, 1595454343, -9.99, 50.12},
+    {60, 18472, 1596024376, 1595990731, 1596057907, -11.56, 48.56},
+    {60, 18479, 1596629143, 1596596760, 1596661421, -13.38, 46.76},
+    {60, 18486, 1597233881, 1597202762, 1597264905, -15.42, 44.74},
+    {60, 18493, 1597838592, 1597808727, 1597868372, -17.64, 42.52},
+    {60, 18500, 1598443280, 1598414653, 1598471832, -20.03, 40.15},
+    {60, 18507, 1599047949, 1599020542, 1599075292, -22.55, 37.64},
+    {60, 18514, 1599652606, 1599626397, 1599678759, -25.16, 35.03},
+    {60, 18521, 1600257256, 1600232226, 1600282238, -27.84, 32.35},
+    {60, 18528, 1600861906, 1600838036, 1600885736, -30.56, 29.64},
+    {60, 18535, 1601466563, 1601443835, 1601489259, -33.28, 26.91},
+    {60, 18542, 1602071234, 1602049628, 1602092815, -35.97, 24.22},
+    {60, 18549, 1602675927, 1602655422, 1602696411, -38.60, 21.58},
+    {60, 18556, 1603280647, 1603261219, 1603300059, -41.13, 19.05},
+    {60, 18563, 1603885400, 1603867017, 1603903771, -43.53, 16.64},
+    {60, 18570, 1604490191, 1604472811, 1604507562, -45.75, 14.41},
+    {60, 18577, 1605095023, 1605078587, 1605111452, -47.75, 12.38},
+    {60, 18584, 1605699897, 1605684327, 1605715462, -49.51, 10.61},
+    {60, 18591, 1606304812, 1606290002, 1606319618, -50.98, 9.12},
+    {60, 18598, 1606909763, 1606895577, 1606923947, -52.13, 7.94},
+    {60, 18605, 1607514744, 1607501014, 1607528474, -52.93, 7.12},
+    {60, 18612, 1608119747, 1608106275, 1608133218, -53.36, 6.66},
+    {60, 18619, 1608724759, 1608711332, 1608738186, -53.43, 6.58},
+    {60, 18626, 1609329770, 1609316169, 1609343371, -53.15, 6.89},
+    {62, 18262, 1577880207, 1577867406, 1577893008, -51.06, 4.98},
+    {62, 18269, 1578485201, 1578471931, 1578498472, -50.34, 5.73},
+    {62, 18276, 1579090170, 1579076234, 1579104108, -49.26, 6.84},
+    {62, 18283, 1579695106, 1579680346, 1579709870, -47.84, 8.27},
+    {62, 18290, 1580300004, 1580284299, 1580315715, -46.13, 10.01},
+    {62, 18297, 1580904861, 1580888123, 1580921610, -44.14, 12.01},
+    {62, 18304, 1581509679, 1581491842, 1581527529, -41.94, 14.23},
+    {62, 18311, 1582114460, 1582095477, 1582133458, -39.54, 16.64},
+    {62, 18318, 1582719206, 1582699046, 1582739389, -36.99, 19.19},
+    {62, 18325, 1583323925, 1583302559, 1583345318, -34.34, 21.85},
+    {62, 18332, 1583928622, 1583906028, 1583951250, -31.61, 24.58},
+    {62, 18339, 1584533304, 1584509461, 1584557189, -28.85, 27.35},
+    {62, 18346, 1585137977, 1585112863, 1585163144, -26.09, 30.11},
+    {62, 18353, 1585742650, 1585716239, 1585769124, -23.36, 32.83},
+    {62, 18360, 1586347329, 1586319593, 1586375138, -20.70, 35.48},
+    {62, 18367, 1586952019, 1586922926, 1586981198, -18.14, 38.03},
+    {62, 18374, 1587556727, 1587526241, 1587587313, -15.72, 40.45},
+    {62, 18381, 1588161457, 1588129538, 1588193492, -13.46, 42.70},
+    {62, 18388, 1588766212, 1588732815, 1588799743, -11.39, 44.74},
+    {62, 18395, 1589370995, 1589336068, 1589406076, -9.56, 46.57},
+    {62, 18402, 1589975806, 1589939286, 1590012501, -7.97, 48.13},
+    {62, 18409, 1590580643, 1590542442, 1590619047, -6.66, 49.42},
+    {62, 18416, 1591185502, 1591145445, 1591225822, -5.66, 50.40},
+    {62, 18423, 1591790378, -1, -1, -4.97, 51.06},
+    {62, 18430, 1592395264, -1, -1, -4.62, 51.40},
+    {62, 18437, 1593000152, -1, -1, -4.62, 51.39},
+    {62, 18444, 1593605035, -1, -1, -4.99, 51.05},
+    {62, 18451, 1594209904, 1594169634, 1594249915, -5.68, 50.38},
+    {62, 18458, 1594814754, 1594776382, 1594852923, -6.68, 49.40},
+    {62, 18465, 1595419578, 1595382902, 1595456080, -7.99, 48.12},
+    {62, 18472, 1596024374, 1595989299, 1596059298, -9.56, 46.56},
+    {62, 18479, 1596629141, 1596595600, 1596662550, -11.38, 44.76},
+    {62, 18486, 1597233879, 1597201817, 1597265825, -13.42, 42.74},
+    {62, 18493, 1597838590, 1597807960, 1597869120, -15.64, 40.52},
+    {62, 18500, 1598443278, 1598414038, 1598472432, -18.03, 38.15},
+    {62, 18507, 1599047947, 1599020059, 1599075762, -20.55, 35.64},
+    {62, 18514, 1599652604, 1599626034, 1599679111, -23.16, 33.03},
+    {62, 18521, 1600257253, 1600231973, 1600282482, -25.84, 30.35},
+    {62, 18528, 1600861904, 1600837887, 1600885877, -28.56, 27.64},
+    {62, 18535, 1601466561, 1601443785, 1601489302, -31.28, 24.91},
+    {62, 18542, 1602071232, 1602049675, 1602092761, -33.97, 22.22},
+    {62, 18549, 1602675925, 1602655564, 1602696263, -36.60, 19.58},
+    {62, 18556, 1603280645, 1603261456, 1603299816, -39.13, 17.05},
+    {62, 18563, 1603885398, 1603867350, 1603903433, -41.53, 14.64},
+    {62, 18570, 1604490189, 1604473240, 1604507129, -43.75, 12.41},
+    {62, 18577, 1605095021, 1605079112, 1605110924, -45.75, 10.38},
+    {62, 18584, 1605699896, 1605684945, 1605714841, -47.51, 8.61},
+    {62, 18591, 1606304811, 1606290707, 1606318910, -48.98, 7.12},
+    {62, 18598, 1606909762, 1606896359, 1606923163, -50.13, 5.94},
+    {62, 18605, 1607514744, 1607501856, 1607527631, -50.93, 5.12},
+    {62, 18612, 1608119747, 1608107153, 1608132340, -51.36, 4.66},
+    {62, 18619, 1608724759, 1608712216, 1608737303, -51.43, 4.58},
+    {62, 18626, 1609329770, 1609317030, 1609342512, -51.15, 4.89},
+    {64, 18262, 1577880207, 1577868426, 1577891989, -49.06, 2.98},
+    {64, 18269, 1578485202, 1578472879, 1578497526, -48.34, 3.73},
+    {64, 18276, 1579090171, 1579077088, 1579103257, -47.26, 4.84},
+    {64, 18283, 1579695107, 1579681092, 1579709127, -45.84, 6.27},
+    {64, 18290, 1580300005, 1580284931, 1580315086, -44.13, 8.01},
+    {64, 18297, 1580904863, 1580888640, 1580921097, -42.14, 10.01},
+    {64, 18304, 1581509681, 1581492246, 1581527130, -39.94, 12.23},
+    {64, 18311, 1582114462, 1582095770, 1582133172, -37.54, 14.64},
+    {64, 18318, 1582719209, 1582699228, 1582739213, -34.99, 17.19},
+    {64, 18325, 1583323927, 1583302632, 1583345253, -32.34, 19.85},
+    {64, 18332, 1583928624, 1583905990, 1583951297, -29.61, 22.58},
+    {64, 18339, 1584533306, 1584509309, 1584557351, -26.85, 25.35},
+    {64, 18346, 1585137980, 1585112592, 1585163427, -24.09, 28.11},
+    {64, 18353, 1585742653, 1585715840, 1585769536, -21.36, 30.83},
+    {64, 18360, 1586347331, 1586319053, 1586375695, -18.70, 33.48},
+    {64, 18367, 1586952021, 1586922226, 1586981919, -16.14, 36.03},
+    {64, 18374, 1587556729, 1587525352, 1587588229, -13.72, 38.45},
+    {64, 18381, 1588161459, 1588128413, 1588194652, -11.46, 40.70},
+    {64, 18388, 1588766214, 1588731377, 1588801233, -9.39, 42.74},
+    {64, 18395, 1589370997, 1589334166, 1589408063, -7.56, 44.57},
+    {64, 18402, 1589975807, 1589936521, 1590015469, -5.97, 46.13},
+    {64, 18409, 1590580644, -1, -1, -4.66, 47.42},
+    {64, 18416, 1591185502, -1, -1, -3.66, 48.40},
+    {64, 18423, 1591790378, -1, -1, -2.97, 49.06},
+    {64, 18430, 1592395264, -1, -1, -2.62, 49.40},
+    {64, 18437, 1593000152, -1, -1, -2.62, 49.39},
+    {64, 18444, 1593605034, -1, -1, -2.99, 49.05},
+    {64, 18451, 1594209903, -1, -1, -3.68, 48.38},
+    {64, 18458, 1594814753, -1, -1, -4.68, 47.40},
+    {64, 18465, 1595419577, 1595379952, 1595458832, -5.99, 46.12},
+    {64, 18472, 1596024373, 1595987313, 1596061199, -7.56, 44.56},
+    {64, 18479, 1596629139, 1596594108, 1596663991, -9.38, 42.76},
+    {64, 18486, 1597233877, 1597200652, 1597266955, -11.42, 40.74},
+    {64, 18493, 1597838588, 1597807038, 1597870016, -13.64, 38.52},
+    {64, 18500, 1598443276, 1598413309, 1598473140, -16.03, 36.15},
+    {64, 18507, 1599047945, 1599019493, 1599076311, -18.55, 33.64},
+    {64, 18514, 1599652601, 1599625611, 1599679520, -21.16, 31.03},
+    {64, 18521, 1600257251, 1600231680, 1600282764, -23.84, 28.35},
+    {64, 18528, 1600861901, 1600837713, 1600886041, -26.56, 25.64},
+    {64, 18535, 1601466558, 1601443725, 1601489353, -29.28, 22.91},
+    {64, 18542, 1602071230, 1602049725, 1602092703, -31.97, 20.22},
+    {64, 18549, 1602675922, 1602655724, 1602696097, -34.60, 17.58},
+    {64, 18556, 1603280643, 1603261725, 1603299542, -37.13, 15.05},
+    {64, 18563, 1603885396, 1603867729, 1603903049, -39.53, 12.64},
+    {64, 18570, 1604490187, 1604473731, 1604506633, -41.75, 10.41},
+    {64, 18577, 1605095020, 1605079717, 1605110315, -43.75, 8.38},
+    {64, 18584, 1605699894, 1605685664, 1605714119, -45.51, 6.61},
+    {64, 18591, 1606304809, 1606291536, 1606318079, -46.98, 5.12},
+    {64, 18598, 1606909761, 1606897286, 1606922234, -48.13, 3.94},
+    {64, 18605, 1607514743, 1607502861, 1607526624, -48.93, 3.12},
+    {64, 18612, 1608119746, 1608108205, 1608131287, -49.36, 2.66},
+    {64, 18619, 1608724759, 1608713277, 1608736242, -49.43, 2.58},
+    {64, 18626, 1609329771, 1609318059, 1609341483, -49.15, 2.89},
+    {66, 18262, 1577880208, 1577869686, 1577890730, -47.06, 0.98},
+    {66, 18269, 1578485203, 1578474038, 1578496369, -46.34, 1.73},
+    {66, 18276, 1579090172, 1579078117, 1579102230, -45.26, 2.84},
+    {66, 18283, 1579695109, 1579681980, 1579708242, -43.84, 4.27},
+    {66, 18290, 1580300007, 1580285675, 1580314346, -42.13, 6.01},
+    {66, 18297, 1580904866, 1580889243, 1580920498, -40.14, 8.01},
+    {66, 18304, 1581509684, 1581492713, 1581526669, -37.94, 10.23},
+    {66, 18311, 1582114465, 1582096105, 1582132843, -35.54, 12.64},
+    {66, 18318, 1582719212, 1582699435, 1582739013, -32.99, 15.19},
+    {66, 18325, 1583323930, 1583302712, 1583345182, -30.34, 17.85},
+    {66, 18332, 1583928627, 1583905943, 1583951354, -27.61, 20.58},
+    {66, 18339, 1584533309, 1584509130, 1584557542, -24.85, 23.35},
+    {66, 18346, 1585137983, 1585112273, 1585163759, -22.09, 26.11},
+    {66, 18353, 1585742656, 1585715370, 1585770023, -19.36, 28.83},
+    {66, 18360, 1586347334, 1586318411, 1586376357, -16.70, 31.48},
+    {66, 18367, 1586952024, 1586921382, 1586982790, -14.14, 34.03},
+    {66, 18374, 1587556731, 1587524254, 1587589365, -11.72, 36.45},
+    {66, 18381, 1588161461, 1588126968, 1588196156, -9.46, 38.70},
+    {66, 18388, 1588766216, 1588729376, 1588803343, -7.39, 40.74},
+    {66, 18395, 1589370999, 1589330840, 1589411844, -5.56, 42.57},
+    {66, 18402, 1589975809, -1, -1, -3.97, 44.13},
+    {66, 18409, 1590580645, -1, -1, -2.66, 45.42},
+    {66, 18416, 1591185503, -1, -1, -1.66, 46.40},
+    {66, 18423, 1591790379, -1, -1, -0.97, 47.06},
+    {66, 18430, 1592395264, -1, -1, -0.62, 47.40},
+    {66, 18437, 1593000152, -1, -1, -0.62, 47.39},
+    {66, 18444, 1593605034, -1, -1, -0.99, 47.05},
+    {66, 18451, 1594209902, -1, -1, -1.68, 46.38},
+    {66, 18458, 1594814751, -1, -1, -2.68, 45.40},
+    {66, 18465, 1595419575, -1, -1, -3.99, 44.12},
+    {66, 18472, 1596024371, 1595983544, 1596064521, -5.56, 42.56},
+    {66, 18479, 1596629137, 1596591992, 1596665998, -7.38, 40.76},
+    {66, 18486, 1597233875, 1597199140, 1597268409, -9.42, 38.74},
+    {66, 18493, 1597838585, 1597805893, 1597871123, -11.64, 36.52},
+    {66, 18500, 1598443273, 1598412428, 1598473994, -14.03, 34.15},
+    {66, 18507, 1599047942, 1599018820, 1599076963, -16.55, 31.64},
+    {66, 18514, 1599652598, 1599625112, 1599680002, -19.16, 29.03},
+    {66, 18521, 1600257248, 1600231334, 1600283095, -21.84, 26.35},
+    {66, 18528, 1600861898, 1600837508, 1600886235, -24.56, 23.64},
+    {66, 18535, 1601466555, 1601443652, 1601489416, -27.28, 20.91},
+    {66, 18542, 1602071227, 1602049780, 1602092640, -29.97, 18.22},
+    {66, 18549, 1602675920, 1602655904, 1602695909, -32.60, 15.58},
+    {66, 18556, 1603280640, 1603262033, 1603299227, -35.13, 13.05},
+    {66, 18563, 1603885393, 1603868167, 1603902605, -37.53, 10.64},
+    {66, 18570, 1604490185, 1604474304, 1604506056, -39.75, 8.41},
+    {66, 18577, 1605095018, 1605080429, 1605109599, -41.75, 6.38},
+    {66, 18584, 1605699892, 1605686519, 1605713261, -43.51, 4.61},
+    {66, 18591, 1606304808, 1606292533, 1606317079, -44.98, 3.12},
+    {66, 18598, 1606909760, 1606898417, 1606921102, -46.13, 1.94},
+    {66, 18605, 1607514743, 1607504101, 1607525383, -46.93, 1.12},
+    {66, 18612, 1608119746, 1608109513, 1608129979, -47.36, 0.66},
+    {66, 18619, 1608724759, 1608714597, 1608734922, -47.43, 0.58},
+    {66, 18626, 1609329771, 1609319333, 1609340210, -47.15, 0.89},
+    {68, 18262, 1577880208, 1577871329, 1577889088, -45.06, -1.02},
+    {68, 18269, 1578485204, 1578475519, 1578494889, -44.34, -0.27},
+    {68, 18276, 1579090174, 1579079405, 1579100945, -43.26, 0.84},
+    {68, 18283, 1579695111, 1579683068, 1579707158, -41.84, 2.27},
+    {68, 18290, 1580300010, 1580286572, 1580313454, -40.13, 4.01},
+    {68, 18297, 1580904868, 1580889960, 1580919787, -38.14, 6.01},
+    {68, 18304, 1581509687, 1581493262, 1581526126, -35.94, 8.23},
+    {68, 18311, 1582114468, 1582096496, 1582132460, -33.54, 10.64},
+    {68, 18318, 1582719215, 1582699674, 1582738783, -30.99, 13.19},
+    {68, 18325, 1583323934, 1583302802, 1583345102, -28.34, 15.85},
+    {68, 18332, 1583928631, 1583905883, 1583951425, -25.61, 18.58},
+    {68, 18339, 1584533313, 1584508916, 1584557770, -22.85, 21.35},
+    {68, 18346, 1585137986, 1585111894, 1585164155, -20.09, 24.11},
+    {68, 18353, 1585742659, 1585714807, 1585770608, -17.36, 26.83},
+    {68, 18360, 1586347337, 1586317633, 1586377164, -14.70, 29.48},
+    {68, 18367, 1586952027, 1586920336, 1586983876, -12.14, 32.03},
+    {68, 18374, 1587556734, 1587522839, 1587590842, -9.72, 34.45},
+    {68, 18381, 1588161464, 1588124945, 1588198302, -7.46, 36.70},
+    {68, 18388, 1588766219, 1588725660, 1588807897, -5.39, 38.74},
+    {68, 18395, 1589371001, -1, -1, -3.56, 40.57},
+    {68, 18402, 1589975811, -1, -1, -1.97, 42.13},
+    {68, 18409, 1590580646, -1, -1, -0.66, 43.42},
+    {68, 18416, 1591185504, -1, -1, 0.34, 44.40},
+    {68, 18423, 1591790379, -1, -1, 1.03, 45.06},
+    {68, 18430, 1592395264, -1, -1, 1.38, 45.40},
+    {68, 18437, 1593000151, -1, -1, 1.38, 45.39},
+    {68, 18444, 1593605033, -1, -1, 1.01, 45.05},
+    {68, 18451, 1594209901, -1, -1, 0.32, 44.38},
+    {68, 18458, 1594814750, -1, -1, -0.68, 43.40},
+    {68, 18465, 1595419573, -1, -1, -1.99, 42.12},
+    {68, 18472, 1596024369, -1, -1, -3.56, 40.56},
+    {68, 18479, 1596629135, 1596587370, 1596669750, -5.38, 38.76},
+    {68, 18486, 1597233872, 1597196976, 1597270448, -7.42, 36.74},
+    {68, 18493, 1597838583, 1597804401, 1597872553, -9.64, 34.52},
+    {68, 18500, 1598443270, 1598411328, 1598475054, -12.03, 32.15},
+    {68, 18507, 1599047939, 1599018000, 1599077755, -14.55, 29.64},
+    {68, 18514, 1599652595, 1599624513, 1599680580, -17.16, 27.03},
+    {68, 18521, 1600257245, 1600230922, 1600283490, -19.84, 24.35},
+    {68, 18528, 1600861895, 1600837263, 1600886465, -22.56, 21.64},
+    {68, 18535, 1601466552, 1601443562, 1601489494, -25.28, 18.91},
+    {68, 18542, 1602071224, 1602049840, 1602092570, -27.97, 16.22},
+    {68, 18549, 1602675916, 1602656112, 1602695692, -30.60, 13.58},
+    {68, 18556, 1603280637, 1603262391, 1603298862, -33.13, 11.05},
+    {68, 18563, 1603885391, 1603868681, 1603902085, -35.53, 8.64},
+    {68, 18570, 1604490182, 1604474983, 1604505371, -37.75, 6.41},
+    {68, 18577, 1605095015, 1605081285, 1605108739, -39.75, 4.38},
+    {68, 18584, 1605699890, 1605687563, 1605712213, -41.51, 2.61},
+    {68, 18591, 1606304806, 1606293775, 1606315834, -42.98, 1.12},
+    {68, 18598, 1606909759, 1606899855, 1606919661, -44.13, -0.06},
+    {68, 18605, 1607514742, 1607505711, 1607523772, -44.93, -0.88},
+    {68, 18612, 1608119746, 1608111235, 1608128256, -45.36, -1.34},
+    {68, 18619, 1608724760, 1608716341, 1608733179, -45.43, -1.42},
+    {68, 18626, 1609329772, 1609320999, 1609338546, -45.15, -1.11},
+    {70, 18262, 1577880209, 1577873710, 1577886709, -43.06, -3.02},
+    {70, 18269, 1578485205, 1578477569, 1578492843, -42.34, -2.27},
+    {70, 18276, 1579090176, 1579081110, 1579099244, -41.26, -1.16},
+    {70, 18283, 1579695113, 1579684459, 1579705771, -39.84, 0.27},
+    {70, 18290, 1580300013, 1580287687, 1580312344, -38.13, 2.01},
+    {70, 18297, 1580904872, 1580890834, 1580918919, -36.14, 4.01},
+    {70, 18304, 1581509690, 1581493921, 1581525474, -33.94, 6.23},
+    {70, 18311, 1582114471, 1582096960, 1582132004, -31.54, 8.64},
+    {70, 18318, 1582719219, 1582699954, 1582738513, -28.99, 11.19},
+    {70, 18325, 1583323938, 1583302905, 1583345011, -26.34, 13.85},
+    {70, 18332, 1583928635, 1583905808, 1583951515, -23.61, 16.58},
+    {70, 18339, 1584533317, 1584508656, 1584558047, -20.85, 19.35},
+    {70, 18346, 1585137990, 1585111434, 1585164637, -18.09, 22.11},
+    {70, 18353, 1585742663, 1585714117, 1585771326, -15.36, 24.83},
+    {70, 18360, 1586347341, 1586316663, 1586378173, -12.70, 27.48},
+    {70, 18367, 1586952031, 1586918985, 1586985289, -10.14, 30.03},
+    {70, 18374, 1587556738, 1587520865, 1587592941, -7.72, 32.45},
+    {70, 18381, 1588161467, 1588121230, 1588202863, -5.46, 34.70},
+    {70, 18388, 1588766222, -1, -1, -3.39, 36.74},
+    {70, 18395, 1589371003, -1, -1, -1.56, 38.57},
+    {70, 18402, 1589975813, -1, -1, 0.03, 40.13},
+    {70, 18409, 1590580648, -1, -1, 1.34, 41.42},
+    {70, 18416, 1591185506, -1, -1, 2.34, 42.40},
+    {70, 18423, 1591790380, -1, -1, 3.03, 43.06},
+    {70, 18430, 1592395264, -1, -1, 3.38, 43.40},
+    {70, 18437, 1593000151, -1, -1, 3.38, 43.39},
+    {70, 18444, 1593605032, -1, -1, 3.01, 43.05},
+    {70, 18451, 1594209900, -1, -1, 2.32, 42.38},
+    {70, 18458, 1594814748, -1, -1, 1.32, 41.40},
+    {70, 18465, 1595419571, -1, -1, 0.01, 40.12},
+    {70, 18472, 1596024366, -1, -1, -1.56, 38.56},
+    {70, 18479, 1596629132, -1, -1, -3.38, 36.76},
+    {70, 18486, 1597233869, 1597192233, 1597274249, -5.42, 34.74},
+    {70, 18493, 1597838579, 1597802271, 1597874555, -7.64, 32.52},
+    {70, 18500, 1598443266, 1598409892, 1598476427, -10.03, 30.15},
+    {70, 18507, 1599047935, 1599016970, 1599078745, -12.55, 27.64},
+    {70, 18514, 1599652591, 1599623776, 1599681288, -15.16, 25.03},
+    {70, 18521, 1600257241, 1600230421, 1600283970, -17.84, 22.35},
+    {70, 18528, 1600861891, 1600836966, 1600886745, -20.56, 19.64},
+    {70, 18535, 1601466548, 1601443451, 1601489591, -23.28, 16.91},
+    {70, 18542, 1602071220, 1602049907, 1602092491, -25.97, 14.22},
+    {70, 18549, 1602675912, 1602656356, 1602695439, -28.60, 11.58},
+    {70, 18556, 1603280633, 1603262815, 1603298429, -31.13, 9.05},
+    {70, 18563, 1603885387, 1603869298, 1603901461, -33.53, 6.64},
+    {70, 18570, 1604490179, 1604475808, 1604504539, -35.75, 4.41},
+    {70, 18577, 1605095012, 1605082344, 1605107674, -37.75, 2.38},
+    {70, 18584, 1605699888, 1605688889, 1605710883, -39.51, 0.61},
+    {70, 18591, 1606304804, 1606295406, 1606314200, -40.98, -0.88},
+    {70, 18598, 1606909757, 1606901824, 1606917689, -42.13, -2.06},
+    {70, 18605, 1607514741, 1607508021, 1607521461, -42.93, -2.88},
+    {70, 18612, 1608119745, 1608113800, 1608125690, -43.36, -3.34},
+    {70, 18619, 1608724760, 1608718956, 1608730563, -43.43, -3.42},
+    {70, 18626, 1609329772, 1609323430, 1609336116, -43.15, -3.11},
+    {75, 18262, 1577880212, -1, -1, -38.06, -8.02},
+    {75, 18269, 1578485210, -1, -1, -37.34, -7.27},
+    {75, 18276, 1579090182, -1, -1, -36.26, -6.16},
+    {75, 18283, 1579695122, 1579692410, 1579697834, -34.84, -4.73},
+    {75, 18290, 1580300023, 1580292606, 1580307442, -33.13, -2.99},
+    {75, 18297, 1580904883, 1580894327, 1580915446, -31.14, -0.99},
+    {75, 18304, 1581509703, 1581496415, 1581523005, -28.94, 1.23},
+    {75, 18311, 1582114485, 1582098653, 1582130340, -26.54, 3.64},
+    {75, 18318, 1582719233, 1582700950, 1582737552, -23.99, 6.19},
+    {75, 18325, 1583323952, 1583303251, 1583344707, -21.34, 8.85},
+    {75, 18332, 1583928650, 1583905512, 1583951863, -18.61, 11.58},
+    {75, 18339, 1584533332, 1584507683, 1584559088, -15.85, 14.35},
+    {75, 18346, 1585138005, 1585109691, 1585166472, -13.09, 17.11},
+    {75, 18353, 1585742677, 1585711405, 1585774178, -10.36, 19.83},
+    {75, 18360, 1586347355, 1586312493, 1586382614, -7.70, 22.48},
+    {75, 18367, 1586952044, 1586910679, -1, -5.14, 25.03},
+    {75, 18374, 1587556750, -1, -1, -2.72, 27.45},
+    {75, 18381, 1588161479, -1, -1, -0.46, 29.70},
+    {75, 18388, 1588766232, -1, -1, 1.61, 31.74},
+    {75, 18395, 1589371013, -1, -1, 3.44, 33.57},
+    {75, 18402, 1589975820, -1, -1, 5.03, 35.13},
+    {75, 18409, 1590580654, -1, -1, 6.34, 36.42},
+    {75, 18416, 1591185510, -1, -1, 7.34, 37.40},
+    {75, 18423, 1591790383, -1, -1, 8.03, 38.06},
+    {75, 18430, 1592395265, -1, -1, 8.38, 38.40},
+    {75, 18437, 1593000150, -1, -1, 8.38, 38.39},
+    {75, 18444, 1593605030, -1, -1, 8.01, 38.05},
+    {75, 18451, 1594209896, -1, -1, 7.32, 37.38},
+    {75, 18458, 1594814742, -1, -1, 6.32, 36.40},
+    {75, 18465, 1595419564, -1, -1, 5.02, 35.12},
+    {75, 18472, 1596024357, -1, -1, 3.44, 33.56},
+    {75, 18479, 1596629122, -1, -1, 1.62, 31.76},
+    {75, 18486, 1597233858, -1, -1, -0.42, 29.74},
+    {75, 18493, 1597838567, -1, -1, -2.64, 27.52},
+    {75, 18500, 1598443253, -1, 1598485668, -5.03, 25.15},
+    {75, 18507, 1599047921, 1599012400, 1599083034, -7.55, 22.64},
+    {75, 18514, 1599652577, 1599620835, 1599684086, -10.16, 20.03},
+    {75, 18521, 1600257226, 1600228508, 1600285789, -12.84, 17.35},
+    {75, 18528, 1600861876, 1600835849, 1600887794, -15.56, 14.64},
+    {75, 18535, 1601466533, 1601443023, 1601489965, -18.28, 11.91},
+    {75, 18542, 1602071205, 1602050124, 1602092231, -20.97, 9.22},
+    {75, 18549, 1602675899, 1602657217, 1602694542, -23.60, 6.58},
+    {75, 18556, 1603280620, 1603264360, 1603296855, -26.13, 4.05},
+    {75, 18563, 1603885375, 1603871615, 1603899119, -28.53, 1.64},
+    {75, 18570, 1604490168, 1604479071, 1604501256, -30.75, -0.59},
+    {75, 18577, 1605095002, 1605086907, 1605103093, -32.75, -2.62},
+    {75, 18584, 1605699879, 1605695818, 1605703939, -34.51, -4.39},
+    {75, 18591, 1606304797, -1, -1, -35.98, -5.88},
+    {75, 18598, 1606909752, -1, -1, -37.13, -7.06},
+    {75, 18605, 1607514737, -1, -1, -37.93, -7.88},
+    {75, 18612, 1608119744, -1, -1, -38.36, -8.34},
+    {75, 18619, 1608724760, -1, -1, -38.43, -8.42},
+    {75, 18626, 1609329775, -1, -1, -38.15, -8.11},
+    {80, 18262, 1577880218, -1, -1, -33.06, -13.02},
+    {80, 18269, 1578485220, -1, -1, -32.34, -12.27},
+    {80, 18276, 1579090196, -1, -1, -31.26, -11.16},
+    {80, 18283, 1579695139, -1, -1, -29.84, -9.73},
+    {80, 18290, 1580300042, -1, -1, -28.13, -7.99},
+    {80, 18297, 1580904905, -1, -1, -26.14, -5.99},
+    {80, 18304, 1581509727, 1581502727, 1581516733, -23.94, -3.77},
+    {80, 18311, 1582114511, 1582102252, 1582126791, -21.54, -1.36},
+    {80, 18318, 1582719260, 1582702907, 1582735657, -18.99, 1.19},
+    {80, 18325, 1583323981, 1583303880, 1583344158, -16.34, 3.85},
+    {80, 18332, 1583928679, 1583904876, 1583952609, -13.61, 6.58},
+    {80, 18339, 1584533361, 1584505647, 1584561288, -10.85, 9.35},
+    {80, 18346, 1585138034, 1585105763, 1585170711, -8.09, 12.11},
+    {80, 18353, 1585742706, 1585703063, -1, -5.36, 14.83},
+    {80, 18360, 1586347382, -1, -1, -2.70, 17.48},
+    {80, 18367, 1586952070, -1, -1, -0.14, 20.03},
+    {80, 18374, 1587556775, -1, -1, 2.28, 22.45},
+    {80, 18381, 1588161501, -1, -1, 4.54, 24.70},
+    {80, 18388, 1588766253, -1, -1, 6.61, 26.74},
+    {80, 18395, 1589371031, -1, -1, 8.44, 28.57},
+    {80, 18402, 1589975836, -1, -1, 10.03, 30.13},
+    {80, 18409, 1590580666, -1, -1, 11.34, 31.42},
+    {80, 18416, 1591185519, -1, -1, 12.34, 32.40},
+    {80, 18423, 1591790388, -1, -1, 13.03, 33.06},
+    {80, 18430, 1592395267, -1, -1, 13.38, 33.40},
+    {80, 18437, 1593000148, -1, -1, 13.38, 33.39},
+    {80, 18444, 1593605024, -1, -1, 13.01, 33.05},
+    {80, 18451, 1594209887, -1, -1, 12.32, 32.38},
+    {80, 18458, 1594814730, -1, -1, 11.32, 31.40},
+    {80, 18465, 1595419549, -1, -1, 10.02, 30.12},
+    {80, 18472, 1596024340, -1, -1, 8.44, 28.56},
+    {80, 18479, 1596629102, -1, -1, 6.62, 26.76},
+    {80, 18486, 1597233835, -1, -1, 4.58, 24.74},
+    {80, 18493, 1597838542, -1, -1, 2.36, 22.52},
+    {80, 18500, 1598443227, -1, -1, -0.03, 20.15},
+    {80, 18507, 1599047894, -1, -1, -2.54, 17.64},
+    {80, 18514, 1599652549, -1, 1599693437, -5.16, 15.03},
+    {80, 18521, 1600257198, 1600224026, 1600289940, -7.84, 12.35},
+    {80, 18528, 1600861847, 1600833476, 1600889995, -10.56, 9.64},
+    {80, 18535, 1601466505, 1601442118, 1601490758, -13.28, 6.91},
+    {80, 18542, 1602071177, 1602050500, 1602091773, -15.97, 4.22},
+    {80, 18549, 1602675871, 1602658900, 1602692795, -18.60, 1.58},
+    {80, 18556, 1603280594, 1603267601, 1603293562, -21.13, -0.95},
+    {80, 18563, 1603885350, 1603877235, 1603893457, -23.53, -3.36},
+    {80, 18570, 1604490145, -1, -1, -25.74, -5.59},
+    {80, 18577, 1605094982, -1, -1, -27.75, -7.62},
+    {80, 18584, 1605699862, -1, -1, -29.51, -9.39},
+    {80, 18591, 1606304783, -1, -1, -30.98, -10.88},
+    {80, 18598, 1606909741, -1, -1, -32.13, -12.06},
+    {80, 18605, 1607514731, -1, -1, -32.93, -12.88},
+    {80, 18612, 1608119741, -1, -1, -33.36, -13.34},
+    {80, 18619, 1608724762, -1, -1, -33.43, -13.42},
+    {80, 18626, 1609329780, -1, -1, -33.15, -13.11},
+    {85, 18262, 1577880236, -1, -1, -28.06, -18.02},
+    {85, 18269, 1578485249, -1, -1, -27.34, -17.27},
+    {85, 18276, 1579090236, -1, -1, -26.25, -16.16},
+    {85, 18283, 1579695189, -1, -1, -24.84, -14.73},
+    {85, 18290, 1580300101, -1, -1, -23.13, -12.99},
+    {85, 18297, 1580904972, -1, -1, -21.14, -10.99},
+    {85, 18304, 1581509800, -1, -1, -18.93, -8.77},
+    {85, 18311, 1582114589, -1, -1, -16.54, -6.36},
+    {85, 18318, 1582719343, 1582709606, 1582729108, -13.99, -3.81},
+    {85, 18325, 1583324066, 1583305650, 1583342608, -11.34, -1.15},
+    {85, 18332, 1583928765, 1583902861, 1583955010, -8.61, 1.58},
+    {85, 18339, 1584533448, 1584498026, 1584570385, -5.85, 4.35},
+    {85, 18346, 1585138121, -1, -1, -3.09, 7.11},
+    {85, 18353, 1585742791, -1, -1, -0.36, 9.83},
+    {85, 18360, 1586347464, -1, -1, 2.30, 12.48},
+    {85, 18367, 1586952149, -1, -1, 4.86, 15.03},
+    {85, 18374, 1587556849, -1, -1, 7.28, 17.45},
+    {85, 18381, 1588161569, -1, -1, 9.54, 19.70},
+    {85, 18388, 1588766313, -1, -1, 11.61, 21.74},
+    {85, 18395, 1589371084, -1, -1, 13.44, 23.57},
+    {85, 18402, 1589975881, -1, -1, 15.03, 25.13},
+    {85, 18409, 1590580702, -1, -1, 16.34, 26.42},
+    {85, 18416, 1591185545, -1, -1, 17.34, 27.40},
+    {85, 18423, 1591790404, -1, -1, 18.03, 28.06},
+    {85, 18430, 1592395272, -1, -1, 18.38, 28.40},
+    {85, 18437, 1593000143, -1, -1, 18.38, 28.39},
+    {85, 18444, 1593605008, -1, -1, 18.01, 28.05},
+    {85, 18451, 1594209861, -1, -1, 17.32, 27.38},
+    {85, 18458, 1594814694, -1, -1, 16.32, 26.40},
+    {85, 18465, 1595419504, -1, -1, 15.02, 25.12},
+    {85, 18472, 1596024287, -1, -1, 13.44, 23.56},
+    {85, 18479, 1596629041, -1, -1, 11.62, 21.76},
+    {85, 18486, 1597233768, -1, -1, 9.58, 19.74},
+    {85, 18493, 1597838470, -1, -1, 7.36, 17.52},
+    {85, 18500, 1598443150, -1, -1, 4.97, 15.15},
+    {85, 18507, 1599047814, -1, -1, 2.46, 12.64},
+    {85, 18514, 1599652466, -1, -1, -0.16, 10.03},
+    {85, 18521, 1600257113, -1, -1, -2.84, 7.35},
+    {85, 18528, 1600861762, 1600822502, 1600898744, -5.56, 4.64},
+    {85, 18535, 1601466419, 1601439192, 1601493267, -8.28, 1.91},
+    {85, 18542, 1602071093, 1602051525, 1602090518, -10.97, -0.78},
+    {85, 18549, 1602675790, 1602664459, 1602687081, -13.60, -3.42},
+    {85, 18556, 1603280516, -1, -1, -16.13, -5.95},
+    {85, 18563, 1603885277, -1, -1, -18.52, -8.36},
+    {85, 18570, 1604490078, -1, -1, -20.74, -10.59},
+    {85, 18577, 1605094922, -1, -1, -22.75, -12.62},
+    {85, 18584, 1605699810, -1, -1, -24.51, -14.39},
+    {85, 18591, 1606304741, -1, -1, -25.98, -15.88},
+    {85, 18598, 1606909710, -1, -1, -27.13, -17.06},
+    {85, 18605, 1607514710, -1, -1, -27.93, -17.88},
+    {85, 18612, 1608119733, -1, -1, -28.36, -18.34},
+    {85, 18619, 1608724765, -1, -1, -28.43, -18.42},
+    {85, 18626, 1609329796, -1, -1, -28.15, -18.11},
+    {90, 18262, 1577880201, -1, -1, -23.06, -22.98},
+    {90, 18269, 1578485191, -1, -1, -22.34, -22.20},
+    {90, 18276, 1579090156, -1, -1, -21.26, -21.07},
+    {90, 18283, 1579695089, -1, -1, -19.84, -19.61},
+    {90, 18290, 1580299984, -1, -1, -18.13, -17.86},
+    {90, 18297, 1580904840, -1, -1, -16.14, -15.84},
+    {90, 18304, 1581509655, -1, -1, -13.94, -13.60},
+    {90, 18311, 1582114434, -1, -1, -11.54, -11.18},
+    {90, 18318, 1582719179, -1, -1, -8.99, -8.62},
+    {90, 18325, 1583323897, -1, -1, -6.34, -5.95},
+    {90, 18332, 1583928594, -1, -1, -3.61, -3.22},
+    {90, 18339, 1584533275, -1, -1, -0.85, -0.45},
+    {90, 18346, 1585137949, -1, -1, 1.91, 2.30},
+    {90, 18353, 1585742623, -1, -1, 4.64, 5.02},
+    {90, 18360, 1586347302, -1, -1, 7.30, 7.67},
+    {90, 18367, 1586951993, -1, -1, 9.86, 10.21},
+    {90, 18374, 1587556703, -1, -1, 12.28, 12.61},
+    {90, 18381, 1588161435, -1, -1, 14.54, 14.85},
+    {90, 18388, 1588766192, -1, -1, 16.61, 16.88},
+    {90, 18395, 1589370978, -1, -1, 18.44, 18.69},
+    {90, 18402, 1589975791, -1, -1, 20.03, 20.23},
+    {90, 18409, 1590580631, -1, -1, 21.34, 21.50},
+    {90, 18416, 1591185493, -1, -1, 22.34, 22.46},
+    {90, 18423, 1591790372, -1, -1, 23.03, 23.10},
+    {90, 18430, 1592395262, -1, -1, 23.38, 23.41},
+    {90, 18437, 1593000154, -1, -1, 23.38, 23.40},
+    {90, 18444, 1593605040, -1, -1, 23.01, 23.09},
+    {90, 18451, 1594209913, -1, -1, 22.32, 22.44},
+    {90, 18458, 1594814765, -1, -1, 21.32, 21.48},
+    {90, 18465, 1595419593, -1, -1, 20.01, 20.22},
+    {90, 18472, 1596024392, -1, -1, 18.44, 18.68},
+    {90, 18479, 1596629161, -1, -1, 16.62, 16.90},
+    {90, 18486, 1597233901, -1, -1, 14.58, 14.89},
+    {90, 18493, 1597838614, -1, -1, 12.36, 12.69},
+    {90, 18500, 1598443303, -1, -1, 9.97, 10.32},
+    {90, 18507, 1599047973, -1, -1, 7.45, 7.82},
+    {90, 18514, 1599652631, -1, -1, 4.84, 5.22},
+    {90, 18521, 1600257281, -1, -1, 2.16, 2.55},
+    {90, 18528, 1600861932, -1, -1, -0.56, -0.17},
+    {90, 18535, 1601466589, -1, -1, -3.28, -2.89},
+    {90, 18542, 1602071260, -1, -1, -5.97, -5.59},
+    {90, 18549, 1602675951, -1, -1, -8.60, -8.23},
+    {90, 18556, 1603280670, -1, -1, -11.13, -10.78},
+    {90, 18563, 1603885422, -1, -1, -13.53, -13.19},
+    {90, 18570, 1604490211, -1, -1, -15.75, -15.44},
+    {90, 18577, 1605095041, -1, -1, -17.75, -17.48},
+    {90, 18584, 1605699912, -1, -1, -19.51, -19.28},
+    {90, 18591, 1606304824, -1, -1, -20.98, -20.79},
+    {90, 18598, 1606909772, -1, -1, -22.13, -21.98},
+    {90, 18605, 1607514751, -1, -1, -22.93, -22.84},
+    {90, 18612, 1608119749, -1, -1, -23.36, -23.32},
+    {90, 18619, 1608724758, -1, -1, -23.43, -23.41},
+    {90, 18626, 1609329765, -1, -1, -23.15, -23.08},
+};
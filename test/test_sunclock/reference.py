@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Generates reference.h, the reference sunrise/sunset table of test_sunclock.
+
+Independent of SunClock.hpp: the sun position comes from the low precision formulas
+of the Astronomical Almanac (about 0.01 degrees, 1950-2050) through right ascension
+and Greenwich sidereal time, and rise/set are the instants the elevation actually
+crosses -5 degrees (zenith 95, as SunClock.hpp), found by bisection over continuous
+time instead of from the hour angle of a fixed declination.
+
+Usage: python3 reference.py > reference.h
+"""
+import math
+
+ELEVATION = -5.0
+LATITUDES = [-90, -85, -80, -75, -70, -68, -66, -64, -62, -60, -50, -40, -30, -20, -10, 0,
+             10, 20, 30, 40, 50, 60, 62, 64, 66, 68, 70, 75, 80, 85, 90]
+FIRST_DAY = 18262  # 2020-01-01, days since 1970-01-01
+LAST_DAY = 18262 + 366
+DAY_STEP = 7
+
+
+def elevation(lat, lng, t):
+    """Sun elevation in degrees at unix time t."""
+    n = t / 86400.0 - 10957.5  # days since J2000.0
+    L = math.radians((280.460 + 0.9856474 * n) % 360)
+    g = math.radians((357.528 + 0.9856003 * n) % 360)
+    ecl_long = L + math.radians(1.915) * math.sin(g) + math.radians(0.020) * math.sin(2 * g)
+    obliquity = math.radians(23.439 - 0.0000004 * n)
+    ra = math.atan2(math.cos(obliquity) * math.sin(ecl_long), math.cos(ecl_long))
+    dec = math.asin(math.sin(obliquity) * math.sin(ecl_long))
+    gmst = math.radians((280.46061837 + 360.98564736629 * n) % 360)
+    hour_angle = gmst + math.radians(lng) - ra
+    phi = math.radians(lat)
+    return math.degrees(math.asin(math.sin(phi) * math.sin(dec) +
+                                  math.cos(phi) * math.cos(dec) * math.cos(hour_angle)))
+
+
+def crossing(lat, lng, a, b):
+    """Instant between a and b where the elevation crosses ELEVATION, None if it does not."""
+    fa = elevation(lat, lng, a) - ELEVATION
+    if (fa > 0) == (elevation(lat, lng, b) - ELEVATION > 0):
+        return None
+    while b - a > 0.01:
+        m = (a + b) / 2
+        if (elevation(lat, lng, m) - ELEVATION > 0) == (fa > 0):
+            a = m
+        else:
+            b = m
+    return (a + b) / 2
+
+
+def transit(lat, lng, day):
+    """Instant of the highest elevation of the day, by golden section around the sampled maximum."""
+    start = day * 86400
+    best = max(range(start, start + 86400, 600), key=lambda t: elevation(lat, lng, t))
+    a, b = best - 600, best + 600
+    for _ in range(60):
+        m1, m2 = a + (b - a) * 0.382, a + (b - a) * 0.618
+        if elevation(lat, lng, m1) < elevation(lat, lng, m2):
+            a = m1
+        else:
+            b = m2
+    return (a + b) / 2
+
+
+def row(lat, day):
+    # At the poles there is no transit, use the longitude one
+    noon = transit(lat if abs(lat) < 90 else 0, 0, day)
+    samples = [elevation(lat, 0, noon + s) for s in range(-43200, 43201, 300)]
+    low, high = min(samples), max(samples)
+    rise = set = None
+    # Last upward crossing before noon, first downward one after it
+    for s in range(0, 43200, 300):
+        if rise is None:
+            rise = crossing(lat, 0, noon - s - 300, noon - s)
+        if set is None:
+            set = crossing(lat, 0, noon + s, noon + s + 300)
+    return (lat, day, round(noon), round(rise) if rise else -1, round(set) if set else -1, low, high)
+
+
+def main():
+    print("// Generated by reference.py, do not edit")
+    print("// latitude, day (since 1970-01-01), solar noon, sunrise, sunset (unix time, longitude 0,")
+    print("// elevation -5 degrees, -1 if none), lowest and highest elevation within 12 h of noon (degrees)")
+    print("static const ReferenceDay REFERENCE[] = {")
+    for lat in LATITUDES:
+        for day in range(FIRST_DAY, LAST_DAY, DAY_STEP):
+            print("    {%d, %d, %d, %d, %d, %.2f, %.2f}," % row(lat, day))
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,317 @@
+/**
+ * SunClock against an independent reference (reference.py) over a latitude x day
+ * grid, polar day and night included, the irradiance crossings and curve against
+ * irradiance(), and the cost of each event on the host.
+ */
+#include <unity.h>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include "SunClock.hpp"
+
+void setUp() {}
+void tearDown() {}
+
+struct ReferenceDay
+{
+    int latitude;
+    long day;
+    long noon, rise, set;
+    double lowest, highest; // elevation
+};
+
+#include "reference.h"
+
+static const double ELEVATION = -5; // zenith 95°
+// Days within this many degrees of grazing the elevation are ambiguous between models
+static const double AMBIGUOUS = 1;
+
+// Worst sunrise/sunset difference from the reference, in seconds, by latitude band
+static long max_error(int max_latitude)
+{
+    long worst = 0;
+    for (const ReferenceDay &r : REFERENCE)
+    {
+        if (std::abs(r.latitude) > max_latitude || r.rise == -1 || r.set == -1 ||
+            r.lowest > ELEVATION - AMBIGUOUS || r.highest < ELEVATION + AMBIGUOUS)
+            continue;
+
+        Sunclock sunclock(r.latitude, 0);
+        time_t date = (time_t)r.day * SECONDS_PER_DAY;
+        worst = std::max(worst, std::labs((long)(sunclock.sunrise(date) - r.rise)));
+        worst = std::max(worst, std::labs((long)(sunclock.sunset(date) - r.set)));
+    }
+    return worst;
+}
+
+// Sunclock takes the declination and equation of time once per day, at its start and one day
+// behind (see j2000_day), while the reference follows the sun: the difference grows with latitude
+void test_rise_set_against_reference()
+{
+    long error50 = max_error(50), error60 = max_error(60), error90 = max_error(90);
+    printf("Sunrise/sunset against the reference: %ld s within 50 deg, %ld s within 60 deg, %ld s beyond\n",
+           error50, error60, error90);
+    TEST_ASSERT_LESS_OR_EQUAL(300, error50);
+    TEST_ASSERT_LESS_OR_EQUAL(420, error60);
+    TEST_ASSERT_LESS_OR_EQUAL(3600, error90);
+}
+
+void test_noon_against_reference()
+{
+    long worst = 0;
+    for (const ReferenceDay &r : REFERENCE)
+    {
+        // Further north and south the elevation barely changes around noon, the reference transit is loose
+        if (std::abs(r.latitude) > 70)
+            continue;
+        Sunclock sunclock(r.latitude, 0);
+        worst = std::max(worst, std::labs((long)(sunclock.solar_noon((time_t)r.day * SECONDS_PER_DAY) - r.noon)));
+    }
+    printf("Solar noon against the reference: %ld s\n", worst);
+    TEST_ASSERT_LESS_OR_EQUAL(90, worst);
+}
+
+// Polar day: rise and set 12 hours around noon. Polar night: both at noon.
+void test_polar_day_and_night()
+{
+    int days = 0, nights = 0;
+    for (const ReferenceDay &r : REFERENCE)
+    {
+        bool day = r.lowest > ELEVATION + AMBIGUOUS;
+        bool night = r.highest < ELEVATION - AMBIGUOUS;
+        if (!day && !night)
+            continue;
+
+        Sunclock sunclock(r.latitude, 0);
+        time_t date = (time_t)r.day * SECONDS_PER_DAY;
+        time_t rise = sunclock.sunrise(date), set = sunclock.sunset(date), noon = sunclock.solar_noon(date);
+        if (day)
+        {
+            days++;
+            TEST_ASSERT_INT_WITHIN(1, noon - 12 * 3600, rise);
+            TEST_ASSERT_INT_WITHIN(1, noon + 12 * 3600, set);
+        }
+        else
+        {
+            nights++;
+            TEST_ASSERT_INT_WITHIN(1, noon, rise);
+            TEST_ASSERT_INT_WITHIN(1, noon, set);
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(50, days);
+    TEST_ASSERT_GREATER_THAN(50, nights);
+}
+
+// sun_events().sun and sun_days() agree with sunrise()/sunset() on every day, polar ones included
+template <typename Clock>
+static void check_events_consistency()
+{
+    for (const ReferenceDay &r : REFERENCE)
+    {
+        Clock sunclock(r.latitude, 0);
+        time_t date = (time_t)r.day * SECONDS_PER_DAY;
+        SunEvents events;
+        SunDay day;
+        sunclock.sun_events(date, events);
+        sunclock.sun_days(date, &day, 1);
+        TEST_ASSERT_EQUAL(sunclock.sunrise(date), events.sun.rise);
+        TEST_ASSERT_EQUAL(sunclock.sunset(date), events.sun.set);
+        TEST_ASSERT_EQUAL(sunclock.solar_noon(date), events.noon);
+        TEST_ASSERT_EQUAL(events.sun.rise, day.rise);
+        TEST_ASSERT_EQUAL(events.sun.set, day.set);
+        TEST_ASSERT_EQUAL(events.noon, day.noon);
+    }
+}
+
+void test_events_consistency()
+{
+    check_events_consistency<Sunclock>();
+    check_events_consistency<SunclockF>();
+}
+
+// Sun times of a local day, as setSunTimes() takes them
+static SunDay local_day(Sunclock &sunclock, double tzOffset, int year, int month, int day)
+{
+    SunDay sunDay;
+    sunclock.sun_days(time_from_civil(year, month, day, 12, 0, 0) - (time_t)(tzOffset * 3600), &sunDay, 1);
+    return sunDay;
+}
+
+// The crossing is within a second of where irradiance (which takes UTC) passes the threshold
+static void assert_crossing(Sunclock &sunclock, double tzOffset, time_t crossing, double threshold)
+{
+    time_t utc = crossing - (time_t)(tzOffset * 3600);
+    TEST_ASSERT_TRUE((sunclock.irradiance(utc - 1) > threshold) != (sunclock.irradiance(utc + 1) > threshold));
+}
+
+void test_irradiance_crossings()
+{
+    // Cuneo at the equinox: morning and evening crossings between sunrise and sunset
+    Sunclock cuneo(44.39, 7.55, 1);
+    SunDay day = local_day(cuneo, 1, 2024, 3, 20);
+    SunRiseSet crossings = cuneo.irradiance_crossings(day, 0.3);
+    TEST_ASSERT_TRUE(day.rise < crossings.rise && crossings.rise < day.noon);
+    TEST_ASSERT_TRUE(day.noon < crossings.set && crossings.set < day.set);
+    assert_crossing(cuneo, 1, crossings.rise, 0.3);
+    assert_crossing(cuneo, 1, crossings.set, 0.3);
+    TEST_ASSERT_EQUAL(crossings.rise, cuneo.irradiance_crossing(day.rise, day.noon, 0.3));
+
+    // A threshold of 0 is the geometric horizon, passed after sunrise (zenith 95°) and before sunset
+    crossings = cuneo.irradiance_crossings(day, 0);
+    assert_crossing(cuneo, 1, crossings.rise, 0);
+    assert_crossing(cuneo, 1, crossings.set, 0);
+    TEST_ASSERT_INT_WITHIN(1800, day.rise + 900, crossings.rise);
+    TEST_ASSERT_INT_WITHIN(1800, day.set - 900, crossings.set);
+
+    // Never reached: dark all day, both at noon
+    crossings = cuneo.irradiance_crossings(day, 1);
+    TEST_ASSERT_EQUAL(-1, cuneo.irradiance_crossing(day.rise, day.noon, 1));
+    TEST_ASSERT_EQUAL(day.noon, crossings.rise);
+    TEST_ASSERT_EQUAL(day.noon, crossings.set);
+
+    // Below irradiance at sunrise and sunset: bright all day, both outside the day
+    time_t start = time_from_civil(2024, 3, 20);
+    crossings = cuneo.irradiance_crossings(day, -0.5);
+    TEST_ASSERT_EQUAL(start - 1, crossings.rise);
+    TEST_ASSERT_EQUAL(start + SECONDS_PER_DAY, crossings.set);
+
+    // Tromsø, west of its time zone: polar day in June, polar night in December
+    Sunclock tromso(69.65, 18.96, 2);
+    day = local_day(tromso, 2, 2024, 6, 21);
+    start = time_from_civil(2024, 6, 21);
+    crossings = tromso.irradiance_crossings(day, 0);
+    TEST_ASSERT_EQUAL(start - 1, crossings.rise);
+    TEST_ASSERT_EQUAL(start + SECONDS_PER_DAY, crossings.set);
+    crossings = tromso.irradiance_crossings(day, 1);
+    TEST_ASSERT_EQUAL(day.noon, crossings.rise);
+    TEST_ASSERT_EQUAL(day.noon, crossings.set);
+    // Low enough to be crossed in the polar day too, at night
+    crossings = tromso.irradiance_crossings(day, 0.2);
+    assert_crossing(tromso, 2, crossings.rise, 0.2);
+    assert_crossing(tromso, 2, crossings.set, 0.2);
+
+    Sunclock winter(69.65, 18.96, 1);
+    day = local_day(winter, 1, 2024, 12, 21);
+    for (double threshold : {0.0, 1.0})
+    {
+        crossings = winter.irradiance_crossings(day, threshold);
+        TEST_ASSERT_EQUAL(day.noon, crossings.rise);
+        TEST_ASSERT_EQUAL(day.noon, crossings.set);
+    }
+
+    // Anchorage, negative offset
+    Sunclock anchorage(61.22, -149.9, -9);
+    day = local_day(anchorage, -9, 2024, 9, 1);
+    crossings = anchorage.irradiance_crossings(day, 0.2);
+    assert_crossing(anchorage, -9, crossings.rise, 0.2);
+    assert_crossing(anchorage, -9, crossings.set, 0.2);
+    TEST_ASSERT_EQUAL(days_from_civil(2024, 9, 1), days_from_time(crossings.rise));
+    TEST_ASSERT_EQUAL(days_from_civil(2024, 9, 1), days_from_time(crossings.set));
+}
+
+// Worst difference of the curve from irradiance() at the instant of each sample, and of
+// the last samples of the day, where the rotation and interpolation drift is largest
+template <typename Clock>
+static void curve_error(double latitude, double longitude, double tzOffset, int year, int month, int day,
+                        int samples, double &worst, double &worstLast)
+{
+    Clock sunclock(latitude, longitude, tzOffset);
+    time_t midnight = time_from_civil(year, month, day) - (time_t)(tzOffset * 3600); // UTC
+    // Any instant of the local day gives the same curve
+    auto curve = sunclock.irradiance_curve(midnight + SECONDS_PER_DAY / 2 + 3600, samples);
+    TEST_ASSERT_EQUAL(samples, curve.remaining());
+
+    decltype(sunclock.irradiance(0)) value;
+    for (int k = 0; k < samples; k++)
+    {
+        TEST_ASSERT_TRUE(curve.next(value));
+        double error = std::fabs(value - sunclock.irradiance(midnight + (time_t)k * SECONDS_PER_DAY / samples));
+        worst = std::max(worst, error);
+        if (k >= samples - samples / 24)
+            worstLast = std::max(worstLast, error);
+    }
+    TEST_ASSERT_EQUAL(0, curve.remaining());
+    TEST_ASSERT_FALSE(curve.next(value));
+}
+
+// Every sample of the day, the last ones included, within bound of irradiance(): time
+// zones east and west of UTC and a half-hour one, both hemispheres, every season
+template <typename Clock>
+static void check_curve(const char *name, double bound)
+{
+    static const struct
+    {
+        double latitude, longitude, tzOffset;
+    } places[] = {{44.39, 7.55, 1}, {-33.87, 151.21, 10}, {40.71, -74.01, -5}, {61.22, -149.9, -9},
+                  {28.61, 77.21, 5.5}, {69.65, 18.96, 2}, {-54.8, -68.3, -3}};
+
+    double worst = 0, worstLast = 0;
+    for (const auto &place : places)
+    {
+        for (int month : {1, 3, 6, 9, 12})
+        {
+            curve_error<Clock>(place.latitude, place.longitude, place.tzOffset, 2024, month, 21, 1440, worst,
+                               worstLast);
+            curve_error<Clock>(place.latitude, place.longitude, place.tzOffset, 2024, month, 21, 96, worst,
+                               worstLast);
+        }
+    }
+    printf("%s curve, worst difference from irradiance(): %.6f, in the last hour %.6f\n", name, worst, worstLast);
+    TEST_ASSERT_TRUE(worst < bound);
+}
+
+void test_irradiance_curve()
+{
+    check_curve<Sunclock>("double", 1e-4);
+    // With SUNCLOCK_FAST_MATH=1 the float curve differs by up to 1.5e-4
+    check_curve<SunclockF>("float", 5e-4);
+}
+
+template <typename Clock, typename Event>
+static double ns_per_call(Event event)
+{
+    volatile time_t sink = 0;
+    int calls = 0;
+    time_t first = time_from_civil(2020, 1, 1);
+    auto start = std::chrono::steady_clock::now();
+    for (int lat = -90; lat <= 90; lat += 10)
+    {
+        Clock sunclock(lat, 0);
+        for (int day = 0; day < 366; day++, calls++)
+            sink = sink + event(sunclock, first + day * SECONDS_PER_DAY);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / calls;
+}
+
+template <typename Clock>
+static void benchmark(const char *name)
+{
+    printf("%s, ns/call: sunrise %.0f, sunset %.0f, solar_noon %.0f, irradiance %.0f\n", name,
+           ns_per_call<Clock>([](Clock &c, time_t t) { return c.sunrise(t); }),
+           ns_per_call<Clock>([](Clock &c, time_t t) { return c.sunset(t); }),
+           ns_per_call<Clock>([](Clock &c, time_t t) { return c.solar_noon(t); }),
+           ns_per_call<Clock>([](Clock &c, time_t t) { return (time_t)(c.irradiance(t) * 1000); }));
+}
+
+// Latitudes -90..90 every 10 degrees, every day of 2020
+void test_benchmark()
+{
+    benchmark<Sunclock>("double");
+    benchmark<SunclockF>("float");
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rise_set_against_reference);
+    RUN_TEST(test_noon_against_reference);
+    RUN_TEST(test_polar_day_and_night);
+    RUN_TEST(test_events_consistency);
+    RUN_TEST(test_irradiance_crossings);
+    RUN_TEST(test_irradiance_curve);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
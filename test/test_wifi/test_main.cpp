@@ -0,0 +1,105 @@
+/**
+ * WifiManager on the simulator, from a boot with a wrong password to the access point of
+ * setup mode: the loop is never held by the network scan, and each route is registered once.
+ */
+#include <unity.h>
+#include <algorithm>
+#include "HelloServer.ino"
+
+void setUp() {}
+void tearDown() {}
+
+// loop() one step at a time, returning the longest scheduler pass
+static unsigned long run(unsigned long ms)
+{
+    unsigned long end = sim::now + ms, worst = 0;
+    while (sim::now < end)
+    {
+        timeClient.takeSnapshot();
+        unsigned long start = sim::now;
+        scheduler.Run();
+        worst = std::max(worst, sim::now - start);
+        sleepUntilNextTask();
+    }
+    return worst;
+}
+
+void test_wrong_password_enters_setup_mode()
+{
+    persistentConfiguration.SetSSID(sim::apSsid.c_str());
+    persistentConfiguration.SetPassword("wrong");
+    persistentConfiguration.SaveConfiguration();
+    setup();
+    TEST_ASSERT_FALSE(wifiManager.IsSetupMode());
+
+    unsigned long worst = run(30000);
+    TEST_ASSERT_TRUE(wifiManager.IsSetupMode());
+    TEST_ASSERT_EQUAL(WIFI_AP, WiFi.getMode());
+    TEST_ASSERT_LESS_OR_EQUAL(10, worst);
+}
+
+void test_routes_registered_once()
+{
+    TEST_ASSERT_EQUAL(1, webServer.Routes("/events"));
+    TEST_ASSERT_EQUAL(1, webServer.Routes("/settings"));
+    TEST_ASSERT_EQUAL(1, webServer.Routes("/set-ap"));
+    TEST_ASSERT_EQUAL(1, webServer.Routes("/save-settings"));
+}
+
+void test_settings_page_lists_the_scan()
+{
+    ESP8266WebServer::Response page = webServer.Request("/");
+    TEST_ASSERT_EQUAL(200, page.code);
+    for (const std::string &ssid : sim::scanResults)
+        TEST_ASSERT_TRUE(page.body.find("<option value=\"" + ssid + "\">") != std::string::npos);
+}
+
+// Days of interval 0 as the settings form posts them: the hidden wd0 field and a box per checked day
+static uint8_t save_weekdays(std::initializer_list<int> checked, bool form = true)
+{
+    std::map<String, String> args = {{"lat", "44.33"}, {"lng", "7.47"}, {"tzoff", "1"}, {"irrth", "0"},
+                                     {"onType0", "0"}, {"onTime0", "18:00"}, {"offType0", "0"}, {"offTime0", "23:00"}};
+    if (form)
+        args["wd0"] = "1";
+    for (int d : checked)
+        args["wd0_" + String(d)] = "1";
+    TEST_ASSERT_EQUAL(200, webServer.Request("/save-settings", args).code);
+    return persistentConfiguration.GetTimerInterval(0).weekdays;
+}
+
+void test_save_settings_weekdays()
+{
+    TEST_ASSERT_EQUAL(0, save_weekdays({0, 1, 2, 3, 4, 5, 6}));
+    TEST_ASSERT_EQUAL(0x22, save_weekdays({1, 5}));
+    TEST_ASSERT_EQUAL(0, save_weekdays({}, false));
+
+    // No day checked disables the interval
+    TEST_ASSERT_EQUAL(NO_WEEKDAYS, save_weekdays({}));
+    TEST_ASSERT_FALSE(LampSchedule::AppliesOn(persistentConfiguration.GetTimerInterval(0), days_from_civil(2024, 5, 1)));
+}
+
+void test_set_ap_saves_and_restarts()
+{
+    bool restarted = false;
+    try
+    {
+        webServer.Request("/set-ap", {{"ssid", sim::apSsid}, {"pass", sim::apPassword}});
+    }
+    catch (const sim::Restart &)
+    {
+        restarted = true;
+    }
+    TEST_ASSERT_TRUE(restarted);
+    TEST_ASSERT_EQUAL_STRING(sim::apPassword.c_str(), persistentConfiguration.GetPassword().c_str());
+}
+
+int main(int argc, char **argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_wrong_password_enters_setup_mode);
+    RUN_TEST(test_routes_registered_once);
+    RUN_TEST(test_settings_page_lists_the_scan);
+    RUN_TEST(test_save_settings_weekdays);
+    RUN_TEST(test_set_ap_saves_and_restarts);
+    return UNITY_END();
+}